@@ -35,6 +35,9 @@ uint8_t gAirCopyIsSendMode;
 
 uint16_t g_FSK_Buffer[36];
 
+AIRCOPY_TxState_t gAircopyTxState;
+static uint8_t gAircopyTxCountdown;
+
 void AIRCOPY_SendMessage(void)
 {
 	uint8_t i;
@@ -49,10 +52,61 @@ void AIRCOPY_SendMessage(void)
 		gAircopyState = AIRCOPY_COMPLETE;
 	}
 	RADIO_PrepareTransmit();
-	BK4819_SendFSKData(g_FSK_Buffer);
-	BK4819_SetupPowerAmplifier(0, 0);
-	BK4819_ToggleGpioOut(BK4819_GPIO5_PIN1, false);
-	gAircopySendCountdown = 30;
+	gAircopyTxState = AIRCOPY_TX_SETTLE;
+	gAircopyTxCountdown = 2;
+}
+
+void AIRCOPY_FinishTransmit(void)
+{
+	if (gAircopyTxState != AIRCOPY_TX_SENDING) {
+		return;
+	}
+	BK4819_StopFSKTransmit();
+	gAircopyTxState = AIRCOPY_TX_RESET;
+	gAircopyTxCountdown = 5;
+}
+
+void AIRCOPY_TimeSlice10ms(void)
+{
+	if (gAircopyTxState == AIRCOPY_TX_IDLE) {
+		return;
+	}
+	if (gAircopyTxCountdown) {
+		gAircopyTxCountdown--;
+		if (gAircopyTxCountdown) {
+			return;
+		}
+	}
+
+	switch (gAircopyTxState) {
+	case AIRCOPY_TX_SETTLE:
+		BK4819_LoadFSKData(g_FSK_Buffer);
+		gAircopyTxState = AIRCOPY_TX_LOADED;
+		gAircopyTxCountdown = 2;
+		break;
+
+	case AIRCOPY_TX_LOADED:
+		BK4819_StartFSKTransmit();
+		gAircopyTxState = AIRCOPY_TX_SENDING;
+		gAircopyTxCountdown = 100;
+		break;
+
+	case AIRCOPY_TX_SENDING:
+		// FSK_TX_FINISHED never arrived
+		AIRCOPY_FinishTransmit();
+		break;
+
+	case AIRCOPY_TX_RESET:
+		BK4819_Idle();
+		BK4819_SetupPowerAmplifier(0, 0);
+		BK4819_ToggleGpioOut(BK4819_GPIO5_PIN1, false);
+		gAircopyTxState = AIRCOPY_TX_IDLE;
+		gAircopySendCountdown = 30;
+		break;
+
+	default:
+		break;
+	}
 }
 
 void AIRCOPY_StorePacket(void)
@@ -136,7 +190,7 @@ static void AIRCOPY_Key_DIGITS(KEY_Code_t Key, bool bKeyPressed, bool bKeyHeld)
 
 static void AIRCOPY_Key_EXIT(bool bKeyPressed, bool bKeyHeld)
 {
-	if (!bKeyHeld && bKeyPressed) {
+	if (!bKeyHeld && bKeyPressed && gAircopyTxState == AIRCOPY_TX_IDLE) {
 		if (gInputBoxIndex == 0) {
 			gFSKWriteIndex = 0;
 			gAirCopyBlockNumber = 0;
@@ -155,7 +209,7 @@ static void AIRCOPY_Key_EXIT(bool bKeyPressed, bool bKeyHeld)
 
 static void AIRCOPY_Key_MENU(bool bKeyPressed, bool bKeyHeld)
 {
-	if (!bKeyHeld && bKeyPressed) {
+	if (!bKeyHeld && bKeyPressed && gAircopyTxState == AIRCOPY_TX_IDLE) {
 		gFSKWriteIndex = 0;
 		gAirCopyBlockNumber = 0;
 		gInputBoxIndex = 0;
@@ -27,14 +27,27 @@ enum AIRCOPY_State_t {
 
 typedef enum AIRCOPY_State_t AIRCOPY_State_t;
 
+enum AIRCOPY_TxState_t {
+	AIRCOPY_TX_IDLE		= 0U,
+	AIRCOPY_TX_SETTLE	= 1U,
+	AIRCOPY_TX_LOADED	= 2U,
+	AIRCOPY_TX_SENDING	= 3U,
+	AIRCOPY_TX_RESET	= 4U,
+};
+
+typedef enum AIRCOPY_TxState_t AIRCOPY_TxState_t;
+
 extern AIRCOPY_State_t gAircopyState;
 extern uint16_t gAirCopyBlockNumber;
 extern uint16_t gErrorsDuringAirCopy;
 extern uint8_t gAirCopyIsSendMode;
+extern AIRCOPY_TxState_t gAircopyTxState;
 
 extern uint16_t g_FSK_Buffer[36];
 
 void AIRCOPY_SendMessage(void);
+void AIRCOPY_FinishTransmit(void);
+void AIRCOPY_TimeSlice10ms(void);
 void AIRCOPY_StorePacket(void);
 
 void AIRCOPY_ProcessKeys(KEY_Code_t Key, bool bKeyPressed, bool bKeyHeld);
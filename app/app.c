@@ -23,6 +23,7 @@
 #include "app/main.h"
 #include "app/menu.h"
 #include "app/scanner.h"
+#include "app/spectrum.h"
 #include "app/uart.h"
 #include "ARMCM0.h"
 #include "audio.h"
@@ -31,9 +32,11 @@
 #include "driver/backlight.h"
 #include "driver/bk1080.h"
 #include "driver/bk4819.h"
+#include "driver/eeprom.h"
 #include "driver/gpio.h"
 #include "driver/keyboard.h"
 #include "driver/st7565.h"
+#include "driver/systick.h"
 #include "driver/system.h"
 #include "dtmf.h"
 #include "external/printf/printf.h"
@@ -51,6 +54,16 @@
 #include "ui/status.h"
 #include "ui/ui.h"
 
+// Both priority channels are checked every 80 ms, each hop taking ~1.2 ms
+#define PRIORITY_WATCH_INTERVAL 8U
+#define PRIORITY_WATCH_SETTLE_US 1200U
+
+// Squelch sampling period on the primary channel while FM is playing
+#define FM_MONITOR_POLL_US 1000U
+
+static uint32_t gFmMonitorNextPoll;
+static uint32_t gFmMonitorLastPoll;
+
 static void APP_ProcessKey(KEY_Code_t Key, bool bKeyPressed, bool bKeyHeld);
 void APP_StartListening(FUNCTION_Type_t Function);
 
@@ -304,6 +317,13 @@ void APP_StartListening(FUNCTION_Type_t Function)
 	if (!gSetting_KILLED) {
 		if (gFmRadioMode) {
 			BK1080_Init(0, false);
+			if (gFmMonitorSquelchTime) {
+				gFmMonitorLatency = SYSTICK_GetMicroseconds() - gFmMonitorSquelchTime;
+				if (gFmMonitorLatency > gFmMonitorLatencyMax) {
+					gFmMonitorLatencyMax = gFmMonitorLatency;
+				}
+				gFmMonitorSquelchTime = 0;
+			}
 		}
 		gVFO_RSSI_Level[gEeprom.RX_CHANNEL == 0] = 0;
 		GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_AUDIO_PATH);
@@ -389,6 +409,8 @@ void APP_MoreRadioStuff(void)
 	RADIO_SetupRegisters(true);
 	gUpdateDisplay = true;
 	ScanPauseDelayIn10msec = 10;
+	gScanRssiCountdown = 3;
+	gScanStepCount++;
 	g_20000413 = 0;
 }
 
@@ -436,6 +458,8 @@ void FUN_00007dd4(void)
 		gUpdateDisplay = true;
 	}
 	ScanPauseDelayIn10msec = 20;
+	gScanRssiCountdown = 3;
+	gScanStepCount++;
 	g_20000413 = 0;
 	if (bEnabled) {
 		g_20000415++;
@@ -445,6 +469,64 @@ void FUN_00007dd4(void)
 	}
 }
 
+static void APP_CheckPriorityWatch(void)
+{
+	uint16_t AfMode;
+	uint32_t Frequency;
+	uint32_t Now;
+	uint8_t Found;
+	uint8_t i;
+
+	gPriorityWatchCountdown = PRIORITY_WATCH_INTERVAL;
+
+	// Probing an open squelch would chop the audio and reset the tone
+	// detectors, so the watch only runs while the channel is quiet.
+	if (gStepDirection || gScreenToDisplay != DISPLAY_MAIN || gEeprom.DUAL_WATCH != DUAL_WATCH_OFF || gCurrentFunction != FUNCTION_0) {
+		// Only count the interval while the watch actually runs
+		gPriorityWatchLast = 0;
+		return;
+	}
+
+	Now = SYSTICK_GetMicroseconds();
+	if (gPriorityWatchLast) {
+		gPriorityRevisitTime = Now - gPriorityWatchLast;
+		if (gPriorityRevisitMax < gPriorityRevisitTime) {
+			gPriorityRevisitMax = gPriorityRevisitTime;
+		}
+	}
+	gPriorityWatchLast = Now;
+
+	// Only the frequency is changed for the probe, so the current
+	// channel is back with the same settings a few ms later.
+	AfMode = BK4819_GetRegister(BK4819_REG_47);
+	BK4819_SetAF(BK4819_AF_MUTE);
+	Found = 0xFF;
+	for (i = 0; i < 2; i++) {
+		if (gPriorityWatchChannel[i] == 0xFF || gPriorityWatchChannel[i] == gRxInfo->CHANNEL_SAVE) {
+			continue;
+		}
+		BK4819_PickRXFilterPathBasedOnFrequency(gPriorityWatchFrequency[i]);
+		BK4819_RetuneRX(gPriorityWatchFrequency[i]);
+		SYSTICK_WaitUntil(SYSTICK_GetMicroseconds() + PRIORITY_WATCH_SETTLE_US);
+		if (BK4819_GetRSSI() >= gRxInfo->SquelchOpenRSSIThresh) {
+			Found = gPriorityWatchChannel[i];
+			break;
+		}
+	}
+	Frequency = gRxInfo->pCurrent->Frequency;
+	BK4819_PickRXFilterPathBasedOnFrequency(Frequency);
+	BK4819_RetuneRX(Frequency);
+	BK4819_WriteRegister(BK4819_REG_47, AfMode);
+
+	if (Found != 0xFF) {
+		gEeprom.MrChannel[gEeprom.RX_CHANNEL] = Found;
+		gEeprom.ScreenChannel[gEeprom.RX_CHANNEL] = Found;
+		RADIO_ConfigureChannel(gEeprom.RX_CHANNEL, 2);
+		RADIO_SetupRegisters(true);
+		gUpdateDisplay = true;
+	}
+}
+
 void NOAA_IncreaseChannel(void)
 {
 	gNoaaChannel++;
@@ -479,11 +561,20 @@ void DUALWATCH_Alternate(void)
 
 void APP_CheckRadioInterrupts(void)
 {
-	if (gScreenToDisplay == DISPLAY_SCANNER) {
+	uint32_t PreviousPoll;
+
+	if (gScreenToDisplay == DISPLAY_SCANNER || gScreenToDisplay == DISPLAY_SPECTRUM) {
 		return;
 	}
 
-	while (BK4819_GetRegister(BK4819_REG_0C) & 1U) {
+	PreviousPoll = gFmMonitorLastPoll;
+	if (gFmRadioMode) {
+		gFmMonitorLastPoll = SYSTICK_GetMicroseconds();
+	} else {
+		gFmMonitorLastPoll = 0;
+	}
+
+	while (BK4819_IsInterruptPending()) {
 		uint16_t Mask;
 
 		BK4819_WriteRegister(BK4819_REG_02, 0);
@@ -539,12 +630,26 @@ void APP_CheckRadioInterrupts(void)
 		}
 		if (Mask & BK4819_REG_02_SQUELCH_LOST) {
 			g_SquelchLost = true;
+			if (gFmRadioMode) {
+				gFmMonitorSquelchTime = SYSTICK_GetMicroseconds();
+				// The squelch opened at some point since the previous poll
+				if (PreviousPoll) {
+					gFmMonitorWindow = gFmMonitorSquelchTime - PreviousPoll;
+					if (gFmMonitorWindow > gFmMonitorWindowMax) {
+						gFmMonitorWindowMax = gFmMonitorWindow;
+					}
+				}
+			}
 			BK4819_ToggleGpioOut(BK4819_GPIO0_PIN28, true);
 		}
 		if (Mask & BK4819_REG_02_SQUELCH_FOUND) {
 			g_SquelchLost = false;
+			gFmMonitorSquelchTime = 0;
 			BK4819_ToggleGpioOut(BK4819_GPIO0_PIN28, false);
 		}
+		if (Mask & BK4819_REG_02_FSK_TX_FINISHED) {
+			AIRCOPY_FinishTransmit();
+		}
 		if (Mask & BK4819_REG_02_FSK_FIFO_ALMOST_FULL && gScreenToDisplay == DISPLAY_AIRCOPY && gAircopyState == AIRCOPY_TRANSFER && gAirCopyIsSendMode == 0) {
 			uint8_t i;
 
@@ -558,9 +663,21 @@ void APP_CheckRadioInterrupts(void)
 
 void TalkRelatedCode(void)
 {
-	RADIO_SendEndOfTransmission();
-	RADIO_EnableCxCSS();
-	RADIO_SetupRegisters(false);
+	RADIO_SendEndOfTransmission(DTMF_TX_END_RELEASE);
+}
+
+static void APP_CheckScanFastSkip(void)
+{
+	if (gCurrentFunction != FUNCTION_0 || gScreenToDisplay == DISPLAY_SCANNER) {
+		return;
+	}
+	// The squelch cannot open below its RSSI threshold, so don't dwell.
+	if (BK4819_GetRSSI() >= gRxInfo->SquelchOpenRSSIThresh) {
+		return;
+	}
+	ScanPauseDelayIn10msec = 0;
+	gSystickFlag9 = true;
+	gScanSkipCount++;
 }
 
 static void FUN_00008334(void)
@@ -581,16 +698,11 @@ static void FUN_00008334(void)
 				} else if (gSystickCountdown11 == 0) {
 					g_200003B4 = 0;
 				}
-				if (gCurrentFunction == FUNCTION_TRANSMIT && !gPttIsPressed && g_200003B4 == 0) {
+				if (gCurrentFunction == FUNCTION_TRANSMIT && !gPttIsPressed && g_200003B4 == 0 && gDTMF_TxState == DTMF_TX_IDLE) {
 					if (g_200003FD == 1) {
 						FUNCTION_Select(FUNCTION_0);
 					} else {
 						TalkRelatedCode();
-						if (gEeprom.REPEATER_TAIL_TONE_ELIMINATION == 0) {
-							FUNCTION_Select(FUNCTION_0);
-						} else {
-							gRTTECountdown = gEeprom.REPEATER_TAIL_TONE_ELIMINATION * 10;
-						}
 					}
 					gUpdateDisplay = true;
 					g_200003FD = 0;
@@ -611,6 +723,20 @@ static void FUN_00008334(void)
 	}
 }
 
+static void APP_CheckFmMonitor(void)
+{
+	uint32_t Now;
+
+	// Sample the squelch between timeslices so the primary channel
+	// takes over from the BK1080 without waiting for the next tick.
+	Now = SYSTICK_GetMicroseconds();
+	if ((int32_t)(Now - gFmMonitorNextPoll) < 0) {
+		return;
+	}
+	gFmMonitorNextPoll = Now + FM_MONITOR_POLL_US;
+	APP_CheckRadioInterrupts();
+}
+
 void APP_Update(void)
 {
 	if (gFlagPlayQueuedVoice) {
@@ -621,14 +747,16 @@ void APP_Update(void)
 	if (gCurrentFunction == FUNCTION_TRANSMIT && gTxTimeoutReached) {
 		gTxTimeoutReached = false;
 		g_200003FD = 1;
-		TalkRelatedCode();
-		AUDIO_PlayBeep(BEEP_500HZ_60MS_DOUBLE_BEEP);
+		RADIO_SendEndOfTransmission(DTMF_TX_END_TAIL);
 		RADIO_SomethingElse(4);
 		GUI_DisplayScreen();
 	}
-	if (gReducedService) {
+	if (gReducedService || gScreenToDisplay == DISPLAY_SPECTRUM) {
 		return;
 	}
+	if (gFmRadioMode && gCurrentFunction == FUNCTION_0) {
+		APP_CheckFmMonitor();
+	}
 	if (gCurrentFunction != FUNCTION_TRANSMIT) {
 		FUN_0000510c();
 	}
@@ -694,7 +822,7 @@ void APP_Update(void)
 	}
 
 	if (gSchedulePowerSave) {
-		if (gEeprom.BATTERY_SAVE == 0 || gStepDirection || g_20000381 || gFmRadioMode || gPttIsPressed || gScreenToDisplay != DISPLAY_MAIN || gKeyBeingHeld || gDTMF_CallState != DTMF_CALL_STATE_NONE) {
+		if (gEeprom.BATTERY_SAVE == 0 || gStepDirection || gPriorityWatch || g_20000381 || gFmRadioMode || gPttIsPressed || gScreenToDisplay != DISPLAY_MAIN || gKeyBeingHeld || gDTMF_CallState != DTMF_CALL_STATE_NONE) {
 			gBatterySaveCountdown = 1000;
 		} else {
 			if ((IS_NOT_NOAA_CHANNEL(gEeprom.ScreenChannel[0]) && IS_NOT_NOAA_CHANNEL(gEeprom.ScreenChannel[1])) || !gIsNoaaMode) {
@@ -706,8 +834,9 @@ void APP_Update(void)
 		gSchedulePowerSave = false;
 	}
 
-	if (gBatterySaveCountdownExpired && gCurrentFunction == FUNCTION_POWER_SAVE && gVoiceWriteIndex == 0) {
+	if (gBatterySaveCountdownExpired && gCurrentFunction == FUNCTION_POWER_SAVE && gVoiceWriteIndex == 0 && !AUDIO_IsBeepPlaying()) {
 		if (gThisCanEnable_BK4819_Rxon) {
+			SYSTEM_SetClockShift(0);
 			BK4819_Conditional_RX_TurnOn_and_GPIO6_Enable();
 			if (gEeprom.VOX_SWITCH) {
 				BK4819_EnableVox(gEeprom.VOX1_THRESHOLD, gEeprom.VOX0_THRESHOLD);
@@ -722,11 +851,12 @@ void APP_Update(void)
 		} else if (gEeprom.DUAL_WATCH == DUAL_WATCH_OFF || gStepDirection || g_20000381 || g_20000382) {
 			gCurrentRSSI = BK4819_GetRSSI();
 			UI_UpdateRSSI(gCurrentRSSI);
-			gBatterySave = gEeprom.BATTERY_SAVE * 10;
+			gBatterySave = BATTERY_GetSaveDuration();
 			gThisCanEnable_BK4819_Rxon = true;
 			BK4819_DisableVox();
 			BK4819_Sleep();
 			BK4819_ToggleGpioOut(BK4819_GPIO6_PIN2, false);
+			SYSTEM_SetClockShift(SYSTEM_CLOCK_SHIFT_STANDBY);
 			// Authentic device checked removed
 		} else {
 			DUALWATCH_Alternate();
@@ -746,27 +876,40 @@ void APP_CheckKeys(void)
 	}
 
 	if (gPttIsPressed) {
+		// Released once the line has read high for 20 ms
 		if (GPIO_CheckBit(&GPIOC->DATA, GPIOC_PIN_PTT)) {
-			SYSTEM_DelayMs(20);
-			if (GPIO_CheckBit(&GPIOC->DATA, GPIOC_PIN_PTT)) {
+			gPttDebounceCounter++;
+			if (gPttDebounceCounter > 2) {
+				gPttDebounceCounter = 0;
 				APP_ProcessKey(KEY_PTT, false, false);
 				gPttIsPressed = false;
 				if (gKeyReading1 != KEY_INVALID) {
 					g_20000394 = true;
 				}
 			}
+		} else {
+			gPttDebounceCounter = 0;
 		}
 	} else {
 		if (!GPIO_CheckBit(&GPIOC->DATA, GPIOC_PIN_PTT)) {
+			if (gPttDebounceCounter == 0) {
+				RADIO_MarkTxPhase(TX_PHASE_PTT_DOWN);
+			}
 			gPttDebounceCounter = gPttDebounceCounter + 1;
-			if (gPttDebounceCounter > 4) {
+			if (gPttDebounceCounter > 1) {
+				gPttDebounceCounter = 0;
 				gPttIsPressed = true;
+				RADIO_MarkTxPhase(TX_PHASE_PTT_ACCEPTED);
 				APP_ProcessKey(KEY_PTT, true, false);
 			}
 		} else {
 			gPttDebounceCounter = 0;
 		}
 	}
+	// The voice chip shares its clock and data lines with the keypad.
+	if (AUDIO_IsVoiceSending()) {
+		return;
+	}
 	Key = KEYBOARD_Poll();
 	if (gKeyReading0 != Key) {
 		if (gKeyReading0 != KEY_INVALID && Key != KEY_INVALID) {
@@ -811,16 +954,31 @@ void APP_TimeSlice10ms(void)
 {
 	gFlashLightBlinkCounter++;
 
+	// The baud rate follows the core clock, so anything received while
+	// scaled down is garbage. Wake up so the host's retry gets through.
+	if (gSystemClockShift && UART_IsDataPending()) {
+		FUNCTION_Select(FUNCTION_0);
+	}
+
 	if (UART_IsCommandAvailable()) {
 		__disable_irq();
 		UART_HandleCommand();
 		__enable_irq();
 	}
 
+	AUDIO_TimeSlice10ms();
+	DTMF_TimeSlice10ms();
+
 	if (gReducedService) {
 		return;
 	}
 
+	// The ADC free runs while awake, this only reads its result
+	if (gCurrentFunction != FUNCTION_TRANSMIT && gCurrentFunction != FUNCTION_POWER_SAVE && !gBatteryTxRecoveryCountdown) {
+		BOARD_ADC_GetBatteryInfo(&gBatteryCurrentVoltage, &gBatteryCurrent);
+		BATTERY_AddSample(gBatteryCurrentVoltage);
+	}
+
 	if (gCurrentFunction != FUNCTION_POWER_SAVE || !gThisCanEnable_BK4819_Rxon) {
 		APP_CheckRadioInterrupts();
 	}
@@ -836,12 +994,29 @@ void APP_TimeSlice10ms(void)
 		}
 	}
 
+	if (gScreenToDisplay == DISPLAY_SPECTRUM) {
+		SPECTRUM_TimeSlice10ms();
+		APP_CheckKeys();
+		return;
+	}
+
 	// Skipping authentic device checks
 
 	if (gFmRadioCountdown) {
 		return;
 	}
 
+	if (gStepDirection) {
+		gScanTickCount++;
+		if (gScanRssiCountdown && --gScanRssiCountdown == 0) {
+			APP_CheckScanFastSkip();
+		}
+	}
+
+	if (gPriorityWatch && --gPriorityWatchCountdown == 0) {
+		APP_CheckPriorityWatch();
+	}
+
 	if (gFlashLightState == FLASHLIGHT_BLINK && (gFlashLightBlinkCounter & 15U) == 0) {
 		GPIO_FlipBit(&GPIOC->DATA, GPIOC_PIN_FLASHLIGHT);
 	}
@@ -869,6 +1044,7 @@ void APP_TimeSlice10ms(void)
 				if (g_20000383 == 1) {
 					g_20000383 = 2;
 					RADIO_EnableCxCSS();
+					SYSTEM_DelayMs(200);
 					BK4819_SetupPowerAmplifier(0, 0);
 					BK4819_ToggleGpioOut(BK4819_GPIO5_PIN1, false);
 					BK4819_Enable_AfDac_DiscMode_TxDsp();
@@ -908,6 +1084,9 @@ void APP_TimeSlice10ms(void)
 		BK4819_CssScanResult_t ScanResult;
 		uint16_t CtcssFreq;
 
+		if (gScanState < 2 && gScanDetectTicks < 0xFFFF) {
+			gScanDetectTicks++;
+		}
 		if (g_2000045D) {
 			g_2000045D--;
 			APP_CheckKeys();
@@ -929,15 +1108,20 @@ void APP_TimeSlice10ms(void)
 			if (Delta < 0) {
 				Delta = -Delta;
 			}
+			// Readings within 1 kHz of the previous one count double,
+			// within 5 kHz single, anything further starts over.
 			if (Delta < 100) {
+				g_2000045F += 2;
+			} else if (Delta < 500) {
 				g_2000045F++;
 			} else {
 				g_2000045F = 0;
 			}
 			BK4819_DisableFrequencyScan();
-			if (g_2000045F < 3) {
+			if (g_2000045F < SCANNER_CONFIDENCE_LOCK) {
 				BK4819_EnableFrequencyScan();
 			} else {
+				gScanDetectLog[gScanDetectLogIndex][0] = gScanDetectTicks;
 				BK4819_SetScanFrequency(gScanFrequency);
 				gCS_ScannedIndex = 0xFF;
 				gCS_ScannedType = 0xFF;
@@ -947,7 +1131,7 @@ void APP_TimeSlice10ms(void)
 				gScanState = 1;
 				GUI_SelectNextDisplay(DISPLAY_SCANNER);
 			}
-			g_2000045D = 0x15;
+			g_2000045D = SCANNER_POLL_HOLDOFF;
 			break;
 
 		case 1:
@@ -971,29 +1155,36 @@ void APP_TimeSlice10ms(void)
 
 				Index = DCS_GetCtcssIndex(CtcssFreq);
 				if (Index != 0xFF) {
-					if (Index == gCS_ScannedIndex && gCS_ScannedType == CODE_TYPE_CONTINUOUS_TONE) {
-						g_2000045F++;
-						if (1 < g_2000045F) {
-							gScanState = 2;
-							g_2000045C = 1;
-						}
-					} else {
+					int16_t Error = CtcssFreq - CTCSS_Options[Index];
+					uint8_t Score;
+
+					// A tone within 0.5 Hz of the table entry counts double
+					Score = (Error > -5 && Error < 5) ? 2 : 1;
+					if (Index != gCS_ScannedIndex || gCS_ScannedType != CODE_TYPE_CONTINUOUS_TONE) {
 						g_2000045F = 0;
 					}
+					g_2000045F += Score;
+					if (g_2000045F >= SCANNER_CONFIDENCE_LOCK) {
+						gScanState = 2;
+						g_2000045C = 1;
+					}
 					gCS_ScannedType = CODE_TYPE_CONTINUOUS_TONE;
 					gCS_ScannedIndex = Index;
 				}
 			}
 			if (gScanState < 2) {
 				BK4819_SetScanFrequency(gScanFrequency);
-				g_2000045D = 0x15;
+				g_2000045D = SCANNER_POLL_HOLDOFF;
 				break;
 			}
+			gScanDetectLog[gScanDetectLogIndex][1] = gScanDetectTicks;
 			GUI_SelectNextDisplay(DISPLAY_SCANNER);
 			break;
 		}
 	}
 
+	AIRCOPY_TimeSlice10ms();
+
 	if (gScreenToDisplay == DISPLAY_AIRCOPY && gAircopyState == AIRCOPY_TRANSFER && gAirCopyIsSendMode == 1) {
 		if (gAircopySendCountdown) {
 			gAircopySendCountdown--;
@@ -1037,12 +1228,21 @@ void APP_TimeSlice500ms(void)
 
 	// Skipped authentic device check
 
-	if (gCurrentFunction != FUNCTION_TRANSMIT) {
-		if ((g_200003E2 & 1) == 0) {
-			BOARD_ADC_GetBatteryInfo(&gBatteryVoltages[gBatteryVoltageIndex++], &gBatteryCurrent);
-			if (gBatteryVoltageIndex > 3) {
-				gBatteryVoltageIndex = 0;
+	if (gCurrentFunction == FUNCTION_TRANSMIT) {
+		// The battery takes a while to recover from the PA load
+		gBatteryTxRecoveryCountdown = 4;
+	} else {
+		if (gBatteryTxRecoveryCountdown) {
+			gBatteryTxRecoveryCountdown--;
+		} else {
+			if (gCurrentFunction == FUNCTION_POWER_SAVE) {
+				// The ADC is stopped and nothing was sampled every 10 ms
+				BOARD_ADC_GetBatteryInfo(&gBatteryCurrentVoltage, &gBatteryCurrent);
+				BATTERY_AddSample(gBatteryCurrentVoltage);
 			}
+			BATTERY_UpdateAverage();
+		}
+		if ((g_200003E2 & 1) == 0) {
 			BATTERY_GetReadings(true);
 		}
 		if (gCurrentFunction != FUNCTION_POWER_SAVE) {
@@ -1123,6 +1323,7 @@ LAB_00004b08:
 					AUDIO_PlayBeep(BEEP_500HZ_60MS_DOUBLE_BEEP);
 					AUDIO_SetVoiceID(0, VOICE_ID_LOW_VOLTAGE);
 					if (gBatteryDisplayLevel == 0) {
+						AUDIO_WaitForBeep();
 						AUDIO_PlaySingleVoice(true);
 						gReducedService = true;
 						FUNCTION_Select(FUNCTION_POWER_SAVE);
@@ -1189,13 +1390,13 @@ void FUN_00001150(void)
 	g_20000383 = 0;
 	GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_AUDIO_PATH);
 	gEnableSpeaker = false;
+	g_200003B6 = 0x50;
 	if (gEeprom.ALARM_MODE == ALARM_MODE_TONE) {
-		RADIO_SendEndOfTransmission();
-		RADIO_EnableCxCSS();
+		RADIO_SendEndOfTransmission(DTMF_TX_END_RX);
+	} else {
+		SYSTEM_DelayMs(5);
+		RADIO_SetupRegisters(true);
 	}
-	g_200003B6 = 0x50;
-	SYSTEM_DelayMs(5);
-	RADIO_SetupRegisters(true);
 	gRequestDisplayScreen = DISPLAY_MAIN;
 }
 
@@ -1231,7 +1432,11 @@ void FUN_000075b0(void)
 		BK4819_PickRXFilterPathBasedOnFrequency(0xFFFFFFFF);
 		BK4819_EnableFrequencyScan();
 	}
-	g_2000045D = 0x15;
+	g_2000045D = SCANNER_POLL_HOLDOFF;
+	gScanDetectTicks = 0;
+	gScanDetectLogIndex = (gScanDetectLogIndex + 1) % SCANNER_LOG_SIZE;
+	gScanDetectLog[gScanDetectLogIndex][0] = 0;
+	gScanDetectLog[gScanDetectLogIndex][1] = 0;
 	gCS_ScannedIndex = 0xFF;
 	gCS_ScannedType = 0xFF;
 	g_2000045F = 0;
@@ -1253,6 +1458,9 @@ void APP_ChangeStepDirectionMaybe(bool bFlag, int8_t Direction)
 	g_20000410 = gRxInfo->CHANNEL_SAVE;
 	g_20000415 = 0;
 	gStepDirection = Direction;
+	gScanStepCount = 0;
+	gScanSkipCount = 0;
+	gScanTickCount = 0;
 	if (IS_MR_CHANNEL(g_20000410)) {
 		if (bFlag) {
 			g_20000414 = g_20000410;
@@ -1265,6 +1473,7 @@ void APP_ChangeStepDirectionMaybe(bool bFlag, int8_t Direction)
 		APP_MoreRadioStuff();
 	}
 	ScanPauseDelayIn10msec = 50;
+	gScanRssiCountdown = 0;
 	gSystickFlag9 = false;
 	g_20000411 = 0;
 	gScanPauseMode = 0;
@@ -1280,6 +1489,41 @@ void APP_FlipVoxSwitch(void)
 	gUpdateStatus = true;
 }
 
+void APP_TogglePriorityWatch(void)
+{
+	uint8_t i;
+
+	if (gPriorityWatch) {
+		gPriorityWatch = false;
+		return;
+	}
+
+	for (i = 0; i < 2; i++) {
+		uint8_t Channel;
+
+		if (i == 0) {
+			Channel = gEeprom.SCANLIST_PRIORITY_CH1[gEeprom.SCAN_LIST_DEFAULT];
+		} else {
+			Channel = gEeprom.SCANLIST_PRIORITY_CH2[gEeprom.SCAN_LIST_DEFAULT];
+		}
+		gPriorityWatchChannel[i] = 0xFF;
+		if (RADIO_CheckValidChannel(Channel, false, 0)) {
+			gPriorityWatchChannel[i] = Channel;
+			EEPROM_ReadBuffer(Channel * 16, &gPriorityWatchFrequency[i], 4);
+			gPriorityWatch = true;
+		}
+	}
+
+	if (!gPriorityWatch) {
+		gBeepToPlay = BEEP_500HZ_60MS_DOUBLE_BEEP_OPTIONAL;
+		return;
+	}
+	gPriorityWatchCountdown = PRIORITY_WATCH_INTERVAL;
+	gPriorityWatchLast = 0;
+	gPriorityRevisitTime = 0;
+	gPriorityRevisitMax = 0;
+}
+
 void APP_CycleOutputPower(void)
 {
 	if (++gTxInfo->OUTPUT_POWER > OUTPUT_POWER_HIGH) {
@@ -1462,6 +1706,14 @@ void FUN_00004404(KEY_Code_t Key, bool bKeyPressed, bool bKeyHeld)
 	case 8:
 		FUN_000056a0(1);
 		break;
+	case 9:
+		if (gCurrentFunction != FUNCTION_TRANSMIT && !gFmRadioMode) {
+			SPECTRUM_Start();
+		}
+		break;
+	case 10:
+		APP_TogglePriorityWatch();
+		break;
 	}
 }
 
@@ -1663,10 +1915,13 @@ static void APP_ProcessKey(KEY_Code_t Key, bool bKeyPressed, bool bKeyHeld)
 			case DISPLAY_AIRCOPY:
 				AIRCOPY_ProcessKeys(Key, bKeyPressed, bKeyHeld);
 				break;
+			case DISPLAY_SPECTRUM:
+				SPECTRUM_ProcessKeys(Key, bKeyPressed, bKeyHeld);
+				break;
 			default:
 				break;
 			}
-		} else if (gScreenToDisplay != DISPLAY_SCANNER && gScreenToDisplay != DISPLAY_AIRCOPY) {
+		} else if (gScreenToDisplay != DISPLAY_SCANNER && gScreenToDisplay != DISPLAY_AIRCOPY && gScreenToDisplay != DISPLAY_SPECTRUM) {
 			FUN_00004404(Key, bKeyPressed, bKeyHeld);
 		} else if (!bKeyHeld && bKeyPressed) {
 			gBeepToPlay = BEEP_500HZ_60MS_DOUBLE_BEEP_OPTIONAL;
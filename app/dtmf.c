@@ -16,6 +16,7 @@
 
 #include <string.h>
 #include "app/fm.h"
+#include "audio.h"
 #include "bsp/dp32g030/gpio.h"
 #include "driver/bk4819.h"
 #include "driver/eeprom.h"
@@ -23,7 +24,9 @@
 #include "driver/system.h"
 #include "dtmf.h"
 #include "external/printf/printf.h"
+#include "functions.h"
 #include "misc.h"
+#include "radio.h"
 #include "settings.h"
 #include "ui/ui.h"
 
@@ -46,6 +49,13 @@ uint8_t gDTMF_RecvTimeout;
 DTMF_CallState_t gDTMF_CallState;
 DTMF_ReplyState_t gDTMF_ReplyState;
 DTMF_CallMode_t gDTMF_CallMode;
+DTMF_TxState_t gDTMF_TxState;
+
+static char gDTMF_TxString[20];
+static uint8_t gDTMF_TxIndex;
+static uint8_t gDTMF_TxCountdown;
+static bool gDTMF_TxDelayFirst;
+static DTMF_TxEnd_t gDTMF_TxEnd;
 
 bool DTMF_ValidateCodes(char *pCode, uint8_t Size)
 {
@@ -282,6 +292,8 @@ void DTMF_Reply(void)
 	const char *pString;
 	uint16_t Delay;
 
+	DTMF_StopTransmit();
+
 	switch (gDTMF_ReplyState) {
 	case DTMF_REPLY_ANI:
 		if (gDTMF_CallMode == DTMF_CALL_MODE_2) {
@@ -320,21 +332,146 @@ void DTMF_Reply(void)
 			Delay = 60;
 		}
 	}
-	SYSTEM_DelayMs(Delay);
 
-	BK4819_EnterDTMF_TX(gEeprom.DTMF_SIDE_TONE);
+	DTMF_Transmit(pString, true, Delay, DTMF_TX_END_RESUME);
+}
 
-	BK4819_PlayDTMFString(
-		pString,
-		1,
-		gEeprom.DTMF_FIRST_CODE_PERSIST_TIME,
-		gEeprom.DTMF_HASH_CODE_PERSIST_TIME,
-		gEeprom.DTMF_CODE_PERSIST_TIME,
-		gEeprom.DTMF_CODE_INTERVAL_TIME);
+void DTMF_Transmit(const char *pString, bool bDelayFirst, uint16_t PreloadTime, DTMF_TxEnd_t End)
+{
+	uint8_t i;
 
-	GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_AUDIO_PATH);
+	DTMF_StopTransmit();
 
+	for (i = 0; pString && pString[i] && i < sizeof(gDTMF_TxString) - 1; i++) {
+		gDTMF_TxString[i] = pString[i];
+	}
+	gDTMF_TxString[i] = 0;
+	gDTMF_TxIndex = 0;
+	gDTMF_TxDelayFirst = bDelayFirst;
+	gDTMF_TxEnd = End;
+	gDTMF_TxCountdown = PreloadTime / 10;
+	if (i) {
+		gDTMF_TxState = DTMF_TX_PRELOAD;
+	} else {
+		gDTMF_TxState = DTMF_TX_GAP;
+	}
+}
+
+void DTMF_SetTransmitEnd(DTMF_TxEnd_t End)
+{
+	if (gDTMF_TxState == DTMF_TX_IDLE) {
+		DTMF_Transmit(NULL, false, 0, End);
+	} else {
+		gDTMF_TxEnd = End;
+	}
+}
+
+void DTMF_StopTransmit(void)
+{
+	if (gDTMF_TxState == DTMF_TX_TONE) {
+		BK4819_EnterTxMute();
+	}
+	gDTMF_TxState = DTMF_TX_IDLE;
+}
+
+// Drops the rest of a sequence when TX ends early. Only the end of a
+// sequence takes the BK4819 out of TX, so that part still runs.
+void DTMF_CancelTransmit(void)
+{
+	if (gDTMF_TxState == DTMF_TX_IDLE) {
+		return;
+	}
+	DTMF_StopTransmit();
+	GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_AUDIO_PATH);
 	gEnableSpeaker = false;
-	BK4819_ExitDTMF_TX(false);
+	RADIO_SetupRegisters(false);
+	if (gDTMF_TxEnd == DTMF_TX_END_TAIL) {
+		AUDIO_PlayBeep(BEEP_500HZ_60MS_DOUBLE_BEEP);
+	}
 }
 
+void DTMF_WaitForTransmit(void)
+{
+	while (gDTMF_TxState != DTMF_TX_IDLE) {
+		SYSTEM_DelayMs(10);
+		DTMF_TimeSlice10ms();
+	}
+}
+
+void DTMF_TimeSlice10ms(void)
+{
+	uint16_t Delay;
+	char Code;
+
+	if (gDTMF_TxState == DTMF_TX_IDLE) {
+		return;
+	}
+	if (gDTMF_TxCountdown) {
+		gDTMF_TxCountdown--;
+		if (gDTMF_TxCountdown) {
+			return;
+		}
+	}
+
+	switch (gDTMF_TxState) {
+	case DTMF_TX_PRELOAD:
+		BK4819_EnterDTMF_TX(gEeprom.DTMF_SIDE_TONE);
+		// Fallthrough
+	case DTMF_TX_GAP:
+		Code = gDTMF_TxString[gDTMF_TxIndex];
+		if (Code) {
+			BK4819_PlayDTMF(Code);
+			BK4819_ExitTxMute();
+			if (gDTMF_TxDelayFirst && gDTMF_TxIndex == 0) {
+				Delay = gEeprom.DTMF_FIRST_CODE_PERSIST_TIME;
+			} else if (Code == '*' || Code == '#') {
+				Delay = gEeprom.DTMF_HASH_CODE_PERSIST_TIME;
+			} else {
+				Delay = gEeprom.DTMF_CODE_PERSIST_TIME;
+			}
+			gDTMF_TxIndex++;
+			gDTMF_TxCountdown = Delay / 10;
+			gDTMF_TxState = DTMF_TX_TONE;
+			break;
+		}
+		GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_AUDIO_PATH);
+		gEnableSpeaker = false;
+		if (gDTMF_TxEnd == DTMF_TX_END_RESUME) {
+			BK4819_ExitDTMF_TX(false);
+			if (gCrossTxRadioInfo->SCRAMBLING_TYPE && gSetting_ScrambleEnable) {
+				BK4819_EnableScramble(gCrossTxRadioInfo->SCRAMBLING_TYPE - 1U);
+			}
+			RADIO_MarkTxPhase(TX_PHASE_AUDIO);
+			gDTMF_TxState = DTMF_TX_IDLE;
+			break;
+		}
+		BK4819_ExitDTMF_TX(true);
+		RADIO_EnableCxCSS();
+		gDTMF_TxCountdown = 20;
+		gDTMF_TxState = DTMF_TX_TAIL;
+		break;
+
+	case DTMF_TX_TONE:
+		BK4819_EnterTxMute();
+		gDTMF_TxCountdown = gEeprom.DTMF_CODE_INTERVAL_TIME / 10;
+		gDTMF_TxState = DTMF_TX_GAP;
+		break;
+
+	case DTMF_TX_TAIL:
+		gDTMF_TxState = DTMF_TX_IDLE;
+		RADIO_SetupRegisters(gDTMF_TxEnd == DTMF_TX_END_RX);
+		if (gDTMF_TxEnd == DTMF_TX_END_TAIL) {
+			AUDIO_PlayBeep(BEEP_500HZ_60MS_DOUBLE_BEEP);
+		} else if (gDTMF_TxEnd == DTMF_TX_END_RELEASE) {
+			if (gEeprom.REPEATER_TAIL_TONE_ELIMINATION == 0) {
+				FUNCTION_Select(FUNCTION_0);
+			} else {
+				gRTTECountdown = gEeprom.REPEATER_TAIL_TONE_ELIMINATION * 10;
+			}
+		}
+		break;
+
+	default:
+		break;
+	}
+}
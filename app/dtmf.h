@@ -53,6 +53,25 @@ enum DTMF_CallMode_t {
 
 typedef enum DTMF_CallMode_t DTMF_CallMode_t;
 
+enum DTMF_TxState_t {
+	DTMF_TX_IDLE = 0U,
+	DTMF_TX_PRELOAD,
+	DTMF_TX_TONE,
+	DTMF_TX_GAP,
+	DTMF_TX_TAIL,
+};
+
+typedef enum DTMF_TxState_t DTMF_TxState_t;
+
+enum DTMF_TxEnd_t {
+	DTMF_TX_END_RESUME = 0U,
+	DTMF_TX_END_TAIL,
+	DTMF_TX_END_RX,
+	DTMF_TX_END_RELEASE,
+};
+
+typedef enum DTMF_TxEnd_t DTMF_TxEnd_t;
+
 extern char gDTMF_String[15];
 extern char gDTMF_InputBox[15];
 extern char gDTMF_Received[16];
@@ -72,6 +91,7 @@ extern uint8_t gDTMF_RecvTimeout;
 extern DTMF_CallState_t gDTMF_CallState;
 extern DTMF_ReplyState_t gDTMF_ReplyState;
 extern DTMF_CallMode_t gDTMF_CallMode;
+extern DTMF_TxState_t gDTMF_TxState;
 
 bool DTMF_ValidateCodes(char *pCode, uint8_t Size);
 bool DTMF_GetContact(uint8_t Index, char *pContact);
@@ -82,6 +102,12 @@ bool DTMF_IsGroupCall(const char *pDTMF, uint32_t Size);
 void DTMF_Append(char Code);
 void DTMF_HandleRequest(void);
 void DTMF_Reply(void);
+void DTMF_Transmit(const char *pString, bool bDelayFirst, uint16_t PreloadTime, DTMF_TxEnd_t End);
+void DTMF_SetTransmitEnd(DTMF_TxEnd_t End);
+void DTMF_StopTransmit(void);
+void DTMF_CancelTransmit(void);
+void DTMF_WaitForTransmit(void);
+void DTMF_TimeSlice10ms(void);
 
 #endif
 
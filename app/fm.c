@@ -28,8 +28,15 @@
 #include "ui/inputbox.h"
 #include "ui/ui.h"
 
+#define FM_SEEK_POLL_TIMEOUT 50
+
 extern void APP_StartScan(bool bFlag);
 
+static uint8_t gFM_Scores[20];
+static bool gFM_SeekAvailable = true;
+static bool gFM_Seeking;
+static uint8_t gFM_SeekPolls;
+
 uint16_t gFM_Channels[20];
 bool gFmRadioMode;
 uint8_t gFmRadioCountdown;
@@ -37,6 +44,11 @@ volatile uint16_t gFmPlayCountdown = 1;
 volatile int8_t gFM_Step;
 bool gFM_AutoScan;
 uint8_t gFM_ChannelPosition;
+uint32_t gFmMonitorSquelchTime;
+uint32_t gFmMonitorLatency;
+uint32_t gFmMonitorLatencyMax;
+uint32_t gFmMonitorWindow;
+uint32_t gFmMonitorWindowMax;
 
 bool FM_CheckValidChannel(uint8_t Channel)
 {
@@ -87,6 +99,7 @@ int FM_ConfigureChannelState(void)
 void FM_TurnOff(void)
 {
 	gFmRadioMode = false;
+	gFM_Seeking = false;
 	gFM_Step = 0;
 	g_2000038E = 0;
 	GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_AUDIO_PATH);
@@ -108,8 +121,64 @@ void FM_EraseChannels(void)
 	memset(gFM_Channels, 0xFF, sizeof(gFM_Channels));
 }
 
+static uint8_t FM_GetSignalScore(void)
+{
+	uint16_t Score;
+
+	Score = (BK1080_ReadRegister(BK1080_REG_10) & 0xFF) + ((BK1080_ReadRegister(BK1080_REG_07) & 0xF) << 1);
+	if (Score > 0xFF) {
+		Score = 0xFF;
+	}
+
+	return Score;
+}
+
+static void FM_RankStation(uint16_t Frequency)
+{
+	uint8_t Score;
+	uint8_t Weakest;
+	uint8_t i;
+
+	Score = FM_GetSignalScore();
+	if (gFM_ChannelPosition < 20) {
+		gFM_Scores[gFM_ChannelPosition] = Score;
+		gFM_Channels[gFM_ChannelPosition++] = Frequency;
+		return;
+	}
+
+	Weakest = 0;
+	for (i = 1; i < 20; i++) {
+		if (gFM_Scores[i] < gFM_Scores[Weakest]) {
+			Weakest = i;
+		}
+	}
+	if (Score > gFM_Scores[Weakest]) {
+		gFM_Scores[Weakest] = Score;
+		gFM_Channels[Weakest] = Frequency;
+	}
+}
+
+static void FM_SortChannels(void)
+{
+	uint16_t Frequency;
+	uint8_t i;
+	uint8_t j;
+
+	for (i = 1; i < 20; i++) {
+		Frequency = gFM_Channels[i];
+		for (j = i; j > 0 && gFM_Channels[j - 1] > Frequency; j--) {
+			gFM_Channels[j] = gFM_Channels[j - 1];
+		}
+		gFM_Channels[j] = Frequency;
+	}
+}
+
 void FM_Tune(uint16_t Frequency, int8_t Step, bool bFlag)
 {
+	if (gFM_Seeking) {
+		BK1080_StopSeek();
+		gFM_Seeking = false;
+	}
 	GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_AUDIO_PATH);
 	gEnableSpeaker = false;
 	if (gFM_Step == 0) {
@@ -138,8 +207,13 @@ void FM_Tune(uint16_t Frequency, int8_t Step, bool bFlag)
 
 void FM_PlayAndUpdate(void)
 {
+	if (gFM_Seeking) {
+		BK1080_StopSeek();
+		gFM_Seeking = false;
+	}
 	gFM_Step = 0;
 	if (gFM_AutoScan) {
+		FM_SortChannels();
 		gEeprom.FM_IsMrMode = true;
 		gEeprom.FM_SelectedChannel = 0;
 	}
@@ -493,9 +567,64 @@ void FM_ProcessKeys(KEY_Code_t Key, bool bKeyPressed, bool bKeyHeld)
 	}
 }
 
+static void FM_ScanNext(void)
+{
+	if (gEeprom.FM_UpperLimit <= gEeprom.FM_FrequencyPlaying) {
+		FM_PlayAndUpdate();
+	} else if (gFM_SeekAvailable) {
+		BK1080_StartSeek();
+		gFM_Seeking = true;
+		gFM_SeekPolls = 0;
+		gFmPlayCountdown = 1;
+	} else {
+		FM_Tune(gEeprom.FM_FrequencyPlaying, gFM_Step, false);
+	}
+}
+
+static void FM_CheckSeek(void)
+{
+	uint16_t Frequency;
+	bool bBandLimit;
+
+	if (!BK1080_IsSeekComplete(&bBandLimit)) {
+		gFmPlayCountdown = 1;
+		gFM_SeekPolls++;
+		if (gFM_SeekPolls % FM_SEEK_POLL_TIMEOUT) {
+			return;
+		}
+		Frequency = BK1080_GetFrequency();
+		if (Frequency != gEeprom.FM_FrequencyPlaying) {
+			gEeprom.FM_FrequencyPlaying = Frequency;
+			gFM_SeekPolls = 0;
+			return;
+		}
+		// A beep mutes the BK1080, which also drops the SEEK bit
+		if (gFM_SeekPolls < FM_SEEK_POLL_TIMEOUT * 2) {
+			BK1080_StartSeek();
+			return;
+		}
+		gFM_SeekAvailable = false;
+		FM_Tune(Frequency, gFM_Step, false);
+		return;
+	}
+
+	Frequency = BK1080_GetFrequency();
+	gEeprom.FM_FrequencyPlaying = Frequency;
+	if (bBandLimit || Frequency > gEeprom.FM_UpperLimit) {
+		FM_PlayAndUpdate();
+		return;
+	}
+	if (!FM_CheckFrequencyLock(Frequency, gEeprom.FM_LowerLimit)) {
+		FM_RankStation(Frequency);
+	}
+	FM_ScanNext();
+}
+
 void FM_Play(void)
 {
-	if (!FM_CheckFrequencyLock(gEeprom.FM_FrequencyPlaying, gEeprom.FM_LowerLimit)) {
+	if (gFM_Seeking) {
+		FM_CheckSeek();
+	} else if (!FM_CheckFrequencyLock(gEeprom.FM_FrequencyPlaying, gEeprom.FM_LowerLimit)) {
 		if (!gFM_AutoScan) {
 			gFmPlayCountdown = 0;
 			g_20000427 = 1;
@@ -505,23 +634,11 @@ void FM_Play(void)
 			GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_AUDIO_PATH);
 			gEnableSpeaker = true;
 		} else {
-			if (gFM_ChannelPosition < 20) {
-				gFM_Channels[gFM_ChannelPosition++] = gEeprom.FM_FrequencyPlaying;
-				if (gEeprom.FM_UpperLimit > gEeprom.FM_FrequencyPlaying) {
-					FM_Tune(gEeprom.FM_FrequencyPlaying, gFM_Step, false);
-				} else {
-					FM_PlayAndUpdate();
-				}
-			} else {
-				FM_PlayAndUpdate();
-			}
+			FM_RankStation(gEeprom.FM_FrequencyPlaying);
+			FM_ScanNext();
 		}
 	} else if (gFM_AutoScan) {
-		if (gEeprom.FM_UpperLimit > gEeprom.FM_FrequencyPlaying) {
-			FM_Tune(gEeprom.FM_FrequencyPlaying, gFM_Step, false);
-		} else {
-			FM_PlayAndUpdate();
-		}
+		FM_ScanNext();
 	} else {
 		FM_Tune(gEeprom.FM_FrequencyPlaying, gFM_Step, false);
 	}
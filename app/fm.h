@@ -29,6 +29,11 @@ extern volatile uint16_t gFmPlayCountdown;
 extern volatile int8_t gFM_Step;
 extern bool gFM_AutoScan;
 extern uint8_t gFM_ChannelPosition;
+extern uint32_t gFmMonitorSquelchTime;
+extern uint32_t gFmMonitorLatency;
+extern uint32_t gFmMonitorLatencyMax;
+extern uint32_t gFmMonitorWindow;
+extern uint32_t gFmMonitorWindowMax;
 // Doubts about whether this should be signed or not.
 extern int16_t gFM_FrequencyDeviation;
 
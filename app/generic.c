@@ -87,11 +87,6 @@ void GENERIC_Key_PTT(bool bKeyPressed)
 					FUNCTION_Select(FUNCTION_0);
 				} else {
 					TalkRelatedCode();
-					if (gEeprom.REPEATER_TAIL_TONE_ELIMINATION == 0) {
-						FUNCTION_Select(FUNCTION_0);
-					} else {
-						gRTTECountdown = gEeprom.REPEATER_TAIL_TONE_ELIMINATION * 10;
-					}
 				}
 				g_200003FD = 0;
 				g_200003B4 = 0;
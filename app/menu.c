@@ -90,6 +90,7 @@ static const VOICE_ID_t MenuVoices[] = {
 	VOICE_ID_INVALID,
 	VOICE_ID_INVALID,
 	VOICE_ID_INVALID,
+	VOICE_ID_INVALID,
 };
 
 static void FUN_000074f8(int8_t Direction)
@@ -952,6 +953,10 @@ static void MENU_Key_EXIT(bool bKeyPressed, bool bKeyHeld)
 static void MENU_Key_MENU(bool bKeyPressed, bool bKeyHeld)
 {
 	if (!bKeyHeld && bKeyPressed) {
+		// The energy estimate is read-only, there is nothing to select
+		if (gMenuCursor == MENU_POWER) {
+			return;
+		}
 		gBeepToPlay = BEEP_1KHZ_60MS_OPTIONAL;
 		gRequestDisplayScreen = DISPLAY_MENU;
 		if (!gIsInSubMenu) {
@@ -26,6 +26,9 @@
 
 DCS_CodeType_t gCS_ScannedType;
 uint8_t gCS_ScannedIndex;
+uint16_t gScanDetectTicks;
+uint16_t gScanDetectLog[SCANNER_LOG_SIZE][2];
+uint8_t gScanDetectLogIndex;
 
 static void SCANNER_Key_DIGITS(KEY_Code_t Key, bool bKeyPressed, bool bKeyHeld)
 {
@@ -20,8 +20,19 @@
 #include "dcs.h"
 #include "driver/keyboard.h"
 
+enum {
+	// Result registers are polled every tick after this many ticks of holdoff
+	SCANNER_POLL_HOLDOFF = 2U,
+	SCANNER_CONFIDENCE_LOCK = 4U,
+	SCANNER_LOG_SIZE = 4U,
+};
+
 extern DCS_CodeType_t gCS_ScannedType;
 extern uint8_t gCS_ScannedIndex;
+// Time to lock the frequency and the sub-tone of the last scans, in 10 ms units
+extern uint16_t gScanDetectTicks;
+extern uint16_t gScanDetectLog[SCANNER_LOG_SIZE][2];
+extern uint8_t gScanDetectLogIndex;
 
 void SCANNER_ProcessKeys(KEY_Code_t Key, bool bKeyPressed, bool bKeyHeld);
 
@@ -0,0 +1,225 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#include <string.h>
+#include "app/spectrum.h"
+#include "audio.h"
+#include "bsp/dp32g030/gpio.h"
+#include "driver/bk4819.h"
+#include "driver/gpio.h"
+#include "driver/systick.h"
+#include "frequencies.h"
+#include "functions.h"
+#include "misc.h"
+#include "radio.h"
+#include "ui/spectrum.h"
+#include "ui/ui.h"
+
+// Bins measured per 10 ms tick and the time each one is given to settle.
+// Leaves roughly half of every tick to the rest of the main loop.
+#define SPECTRUM_BINS_PER_TICK 4U
+#define SPECTRUM_SETTLE_US 1200U
+
+static const uint16_t SPECTRUM_Steps[] = {
+	625,
+	1250,
+	2500,
+	5000,
+	10000,
+};
+
+uint32_t gSpectrumCenter;
+uint8_t gSpectrumStepIndex = 2;
+uint8_t gSpectrumLevel[SPECTRUM_BINS];
+uint8_t gSpectrumPeak[SPECTRUM_BINS];
+uint16_t gSpectrumBinsPerSecond;
+uint8_t gSpectrumHistory[SPECTRUM_HISTORY][SPECTRUM_BINS / 4];
+uint8_t gSpectrumHistoryIndex;
+bool gSpectrumWaterfall;
+
+static uint8_t gSpectrumBin;
+static uint32_t gSpectrumSweepStart;
+
+uint8_t SPECTRUM_GetHistory(uint8_t Age, uint8_t Bin)
+{
+	const uint8_t *pRow = gSpectrumHistory[(gSpectrumHistoryIndex + Age) % SPECTRUM_HISTORY];
+
+	return (pRow[Bin >> 2] >> ((Bin & 3U) * 2U)) & 3U;
+}
+
+static void SPECTRUM_StoreHistory(void)
+{
+	uint8_t *pRow;
+	uint8_t i;
+
+	// The newest sweep is always at gSpectrumHistoryIndex
+	if (gSpectrumHistoryIndex == 0) {
+		gSpectrumHistoryIndex = SPECTRUM_HISTORY;
+	}
+	gSpectrumHistoryIndex--;
+	pRow = gSpectrumHistory[gSpectrumHistoryIndex];
+	memset(pRow, 0, SPECTRUM_BINS / 4);
+	for (i = 0; i < SPECTRUM_BINS; i++) {
+		pRow[i >> 2] |= ((gSpectrumLevel[i] + 10) / 11) << ((i & 3U) * 2U);
+	}
+}
+
+uint16_t SPECTRUM_GetStep(void)
+{
+	return SPECTRUM_Steps[gSpectrumStepIndex];
+}
+
+static void SPECTRUM_ClampCenter(void)
+{
+	const uint32_t Half = (SPECTRUM_BINS / 2) * SPECTRUM_Steps[gSpectrumStepIndex];
+	const uint32_t Lower = LowerLimitFrequencyBandTable[0] + Half;
+	const uint32_t Upper = UpperLimitFrequencyBandTable[6] - Half;
+
+	if (gSpectrumCenter < Lower) {
+		gSpectrumCenter = Lower;
+	} else if (gSpectrumCenter > Upper) {
+		gSpectrumCenter = Upper;
+	}
+}
+
+static void SPECTRUM_Restart(void)
+{
+	SPECTRUM_ClampCenter();
+	memset(gSpectrumLevel, 0, sizeof(gSpectrumLevel));
+	memset(gSpectrumPeak, 0, sizeof(gSpectrumPeak));
+	memset(gSpectrumHistory, 0, sizeof(gSpectrumHistory));
+	BK4819_PickRXFilterPathBasedOnFrequency(gSpectrumCenter);
+	gSpectrumBin = 0;
+	gSpectrumSweepStart = SYSTICK_GetMicroseconds();
+	gUpdateDisplay = true;
+}
+
+void SPECTRUM_Start(void)
+{
+	gSpectrumCenter = gRxInfo->ConfigRX.Frequency;
+	RADIO_SetupRegisters(true);
+	// Squelch events are meaningless while the receiver hops around.
+	BK4819_WriteRegister(BK4819_REG_3F, 0);
+	BK4819_SetAF(BK4819_AF_MUTE);
+	GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_AUDIO_PATH);
+	gEnableSpeaker = false;
+	gSpectrumBinsPerSecond = 0;
+	SPECTRUM_Restart();
+	gRequestDisplayScreen = DISPLAY_SPECTRUM;
+}
+
+void SPECTRUM_TimeSlice10ms(void)
+{
+	const uint32_t Start = gSpectrumCenter - ((SPECTRUM_BINS / 2) * SPECTRUM_Steps[gSpectrumStepIndex]);
+	uint8_t i;
+
+	for (i = 0; i < SPECTRUM_BINS_PER_TICK; i++) {
+		uint16_t Rssi;
+		uint8_t Level;
+
+		BK4819_RetuneRX(Start + (gSpectrumBin * SPECTRUM_Steps[gSpectrumStepIndex]));
+		SYSTICK_WaitUntil(SYSTICK_GetMicroseconds() + SPECTRUM_SETTLE_US);
+
+		// Roughly -130 dBm to -50 dBm over the bar height
+		Rssi = BK4819_GetRSSI();
+		Level = 0;
+		if (Rssi > 60) {
+			Rssi = (Rssi - 60) / 5;
+			Level = (Rssi < SPECTRUM_HEIGHT) ? Rssi : SPECTRUM_HEIGHT;
+		}
+		gSpectrumLevel[gSpectrumBin] = Level;
+		if (gSpectrumPeak[gSpectrumBin] < Level) {
+			gSpectrumPeak[gSpectrumBin] = Level;
+		}
+
+		gSpectrumBin++;
+		if (gSpectrumBin == SPECTRUM_BINS) {
+			const uint32_t Now = SYSTICK_GetMicroseconds();
+
+			gSpectrumBinsPerSecond = (SPECTRUM_BINS * 1000000U) / (Now - gSpectrumSweepStart);
+			gSpectrumSweepStart = Now;
+			gSpectrumBin = 0;
+			SPECTRUM_StoreHistory();
+			UI_UpdateSpectrum();
+			break;
+		}
+	}
+}
+
+static void SPECTRUM_Key_UP_DOWN(bool bKeyPressed, int8_t Direction)
+{
+	const uint32_t Shift = (SPECTRUM_BINS / 4) * SPECTRUM_Steps[gSpectrumStepIndex];
+
+	if (!bKeyPressed) {
+		return;
+	}
+	// Both ends are clamped to the band table by SPECTRUM_Restart
+	if (Direction > 0) {
+		gSpectrumCenter += Shift;
+	} else {
+		gSpectrumCenter -= Shift;
+	}
+	SPECTRUM_Restart();
+}
+
+void SPECTRUM_ProcessKeys(KEY_Code_t Key, bool bKeyPressed, bool bKeyHeld)
+{
+	switch (Key) {
+	case KEY_UP:
+		SPECTRUM_Key_UP_DOWN(bKeyPressed, 1);
+		return;
+	case KEY_DOWN:
+		SPECTRUM_Key_UP_DOWN(bKeyPressed, -1);
+		return;
+	default:
+		break;
+	}
+
+	if (bKeyHeld || !bKeyPressed) {
+		return;
+	}
+
+	switch (Key) {
+	case KEY_STAR:
+		gBeepToPlay = BEEP_1KHZ_60MS_OPTIONAL;
+		gSpectrumStepIndex++;
+		if (gSpectrumStepIndex >= sizeof(SPECTRUM_Steps) / sizeof(SPECTRUM_Steps[0])) {
+			gSpectrumStepIndex = 0;
+		}
+		SPECTRUM_Restart();
+		break;
+	case KEY_0:
+		gBeepToPlay = BEEP_1KHZ_60MS_OPTIONAL;
+		gSpectrumWaterfall = !gSpectrumWaterfall;
+		UI_UpdateSpectrum();
+		break;
+	case KEY_MENU:
+		gBeepToPlay = BEEP_1KHZ_60MS_OPTIONAL;
+		memset(gSpectrumPeak, 0, sizeof(gSpectrumPeak));
+		UI_UpdateSpectrum();
+		break;
+	case KEY_EXIT:
+	case KEY_PTT:
+		gBeepToPlay = BEEP_1KHZ_60MS_OPTIONAL;
+		gVfoConfigureMode = VFO_CONFIGURE_RELOAD;
+		gRequestDisplayScreen = DISPLAY_MAIN;
+		break;
+	default:
+		gBeepToPlay = BEEP_500HZ_60MS_DOUBLE_BEEP_OPTIONAL;
+		break;
+	}
+}
+
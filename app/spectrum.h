@@ -0,0 +1,49 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#ifndef APP_SPECTRUM_H
+#define APP_SPECTRUM_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "driver/keyboard.h"
+
+enum {
+	SPECTRUM_BINS = 64U,
+	SPECTRUM_HEIGHT = 32U,
+	SPECTRUM_HISTORY = 32U,
+};
+
+// Two bits per bin and one row per sweep: 32 * 16 = 512 bytes of history.
+// The level and peak arrays add 128 bytes, 640 bytes of RAM in total.
+extern uint8_t gSpectrumHistory[SPECTRUM_HISTORY][SPECTRUM_BINS / 4];
+extern uint8_t gSpectrumHistoryIndex;
+extern bool gSpectrumWaterfall;
+
+extern uint32_t gSpectrumCenter;
+extern uint8_t gSpectrumStepIndex;
+extern uint8_t gSpectrumLevel[SPECTRUM_BINS];
+extern uint8_t gSpectrumPeak[SPECTRUM_BINS];
+extern uint16_t gSpectrumBinsPerSecond;
+
+uint8_t SPECTRUM_GetHistory(uint8_t Age, uint8_t Bin);
+uint16_t SPECTRUM_GetStep(void);
+void SPECTRUM_Start(void);
+void SPECTRUM_TimeSlice10ms(void);
+void SPECTRUM_ProcessKeys(KEY_Code_t Key, bool bKeyPressed, bool bKeyHeld);
+
+#endif
+
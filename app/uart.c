@@ -15,7 +15,9 @@
  */
 
 #include <string.h>
+#include "ARMCM0.h"
 #include "app/fm.h"
+#include "app/scanner.h"
 #include "app/uart.h"
 #include "board.h"
 #include "bsp/dp32g030/dma.h"
@@ -25,9 +27,13 @@
 #include "driver/crc.h"
 #include "driver/eeprom.h"
 #include "driver/gpio.h"
+#include "driver/systick.h"
 #include "driver/uart.h"
 #include "functions.h"
+#include "helper/energy.h"
+#include "helper/stack.h"
 #include "misc.h"
+#include "radio.h"
 #include "settings.h"
 #include "sram-overlay.h"
 
@@ -128,6 +134,78 @@ typedef struct {
 	uint32_t Timestamp;
 } CMD_052F_t;
 
+typedef struct {
+	Header_t Header;
+	struct {
+		uint32_t Latency[TX_PHASE_COUNT - 1];
+	} Data;
+} REPLY_0531_t;
+
+typedef struct {
+	Header_t Header;
+	struct {
+		uint16_t Size;
+		uint8_t Padding[2];
+		uint32_t Time;
+	} Data;
+} REPLY_0533_t;
+
+typedef struct {
+	Header_t Header;
+	struct {
+		uint32_t Steps;
+		uint32_t Skips;
+		uint32_t Time;
+		uint32_t Rate;
+	} Data;
+} REPLY_0535_t;
+
+typedef struct {
+	Header_t Header;
+	struct {
+		uint32_t Log[SCANNER_LOG_SIZE][2];
+	} Data;
+} REPLY_0537_t;
+
+typedef struct {
+	Header_t Header;
+	struct {
+		uint32_t Interval;
+		uint32_t MaxInterval;
+	} Data;
+} REPLY_0539_t;
+
+typedef struct {
+	Header_t Header;
+	struct {
+		uint32_t Time[ENERGY_COUNT];
+		uint32_t Consumption;
+	} Data;
+} REPLY_053B_t;
+
+typedef struct {
+	Header_t Header;
+	uint16_t Model[ENERGY_COUNT];
+} CMD_053D_t;
+
+typedef struct {
+	Header_t Header;
+	struct {
+		uint32_t Latency;
+		uint32_t MaxLatency;
+		uint32_t Window;
+		uint32_t MaxWindow;
+	} Data;
+} REPLY_053F_t;
+
+typedef struct {
+	Header_t Header;
+	struct {
+		uint16_t Used;
+		uint16_t Size;
+	} Data;
+} REPLY_0541_t;
+
 static const uint8_t Obfuscation[16] = { 0x16, 0x6C, 0x14, 0xE6, 0x2E, 0x91, 0x0D, 0x40, 0x21, 0x35, 0xD5, 0x40, 0x13, 0x03, 0xE9, 0x80 };
 
 static union {
@@ -376,6 +454,163 @@ static void CMD_052F(const uint8_t *pBuffer)
 	SendVersion();
 }
 
+static void CMD_0531(void)
+{
+	REPLY_0531_t Reply;
+	uint8_t i;
+
+	Reply.Header.ID = 0x0532;
+	Reply.Header.Size = sizeof(Reply.Data);
+	// Microseconds from the first PTT edge, zero for phases not reached.
+	for (i = 0; i < TX_PHASE_COUNT - 1; i++) {
+		if (gTxPhaseTime[i + 1] && gTxPhaseTime[TX_PHASE_PTT_DOWN]) {
+			Reply.Data.Latency[i] = gTxPhaseTime[i + 1] - gTxPhaseTime[TX_PHASE_PTT_DOWN];
+		} else {
+			Reply.Data.Latency[i] = 0;
+		}
+	}
+	SendReply(&Reply, sizeof(Reply));
+}
+
+static void CMD_0533(void)
+{
+	REPLY_0533_t Reply;
+	uint8_t Buffer[128];
+	uint32_t Cycles;
+	uint32_t Previous;
+	uint32_t Current;
+	uint16_t Offset;
+
+	// Commands run with interrupts off, so count SysTick cycles directly.
+	// Each chunk takes well under one 10 ms period.
+	Cycles = 0;
+	Previous = SysTick->VAL;
+	(void)SysTick->CTRL;
+	for (Offset = 0; Offset < 0x2000; Offset += sizeof(Buffer)) {
+		EEPROM_ReadBuffer(Offset, Buffer, sizeof(Buffer));
+		Current = SysTick->VAL;
+		if (SysTick->CTRL & SysTick_CTRL_COUNTFLAG_Msk) {
+			Current = SysTick->VAL;
+			Cycles += Previous + (SysTick->LOAD + 1U - Current);
+		} else {
+			Cycles += Previous - Current;
+		}
+		Previous = Current;
+	}
+
+	Reply.Header.ID = 0x0534;
+	Reply.Header.Size = sizeof(Reply.Data);
+	Reply.Data.Size = Offset;
+	Reply.Data.Padding[0] = 0;
+	Reply.Data.Padding[1] = 0;
+	Reply.Data.Time = Cycles / SYSTICK_GetTickMultiplier();
+	SendReply(&Reply, sizeof(Reply));
+}
+
+static void CMD_0535(void)
+{
+	REPLY_0535_t Reply;
+
+	Reply.Header.ID = 0x0536;
+	Reply.Header.Size = sizeof(Reply.Data);
+	Reply.Data.Steps = gScanStepCount;
+	Reply.Data.Skips = gScanSkipCount;
+	Reply.Data.Time = gScanTickCount * 10U;
+	// Channels per second in tenths
+	Reply.Data.Rate = 0;
+	if (gScanTickCount) {
+		Reply.Data.Rate = (gScanStepCount * 1000U) / gScanTickCount;
+	}
+	SendReply(&Reply, sizeof(Reply));
+}
+
+static void CMD_0537(void)
+{
+	REPLY_0537_t Reply;
+	uint8_t i;
+
+	Reply.Header.ID = 0x0538;
+	Reply.Header.Size = sizeof(Reply.Data);
+	// Newest scan first
+	for (i = 0; i < SCANNER_LOG_SIZE; i++) {
+		const uint8_t Index = (gScanDetectLogIndex + SCANNER_LOG_SIZE - i) % SCANNER_LOG_SIZE;
+
+		Reply.Data.Log[i][0] = gScanDetectLog[Index][0] * 10U;
+		Reply.Data.Log[i][1] = gScanDetectLog[Index][1] * 10U;
+	}
+	SendReply(&Reply, sizeof(Reply));
+}
+
+static void CMD_0539(void)
+{
+	REPLY_0539_t Reply;
+
+	Reply.Header.ID = 0x053A;
+	Reply.Header.Size = sizeof(Reply.Data);
+	Reply.Data.Interval = gPriorityRevisitTime;
+	Reply.Data.MaxInterval = gPriorityRevisitMax;
+	SendReply(&Reply, sizeof(Reply));
+}
+
+static void CMD_053B(void)
+{
+	REPLY_053B_t Reply;
+	uint8_t i;
+
+	Reply.Header.ID = 0x053C;
+	Reply.Header.Size = sizeof(Reply.Data);
+	// Seconds in each state and the estimate in uAh
+	for (i = 0; i < ENERGY_COUNT; i++) {
+		Reply.Data.Time[i] = gEnergyTicks[i] / 100U;
+	}
+	Reply.Data.Consumption = ENERGY_GetConsumption();
+	SendReply(&Reply, sizeof(Reply));
+}
+
+static void CMD_053D(const uint8_t *pBuffer)
+{
+	const CMD_053D_t *pCmd = (const CMD_053D_t *)pBuffer;
+
+	if (pCmd->Header.Size < sizeof(pCmd->Model)) {
+		return;
+	}
+
+	memcpy(gEnergyModel, pCmd->Model, sizeof(gEnergyModel));
+	CMD_053B();
+}
+
+static void CMD_053F(void)
+{
+	REPLY_053F_t Reply;
+
+	Reply.Header.ID = 0x0540;
+	Reply.Header.Size = sizeof(Reply.Data);
+	// Microseconds from the squelch opening to the BK1080 being muted.
+	Reply.Data.Latency = gFmMonitorLatency;
+	Reply.Data.MaxLatency = gFmMonitorLatencyMax;
+	// Time between the previous poll and the one that saw the squelch
+	// open. The opening itself can be anywhere in this window.
+	Reply.Data.Window = gFmMonitorWindow;
+	Reply.Data.MaxWindow = gFmMonitorWindowMax;
+	SendReply(&Reply, sizeof(Reply));
+}
+
+static void CMD_0541(void)
+{
+	REPLY_0541_t Reply;
+
+	Reply.Header.ID = 0x0542;
+	Reply.Header.Size = sizeof(Reply.Data);
+	Reply.Data.Used = STACK_GetHighWaterMark();
+	Reply.Data.Size = STACK_GetSize();
+	SendReply(&Reply, sizeof(Reply));
+}
+
+bool UART_IsDataPending(void)
+{
+	return gUART_WriteIndex != (DMA_CH0->ST & 0xFFFU);
+}
+
 bool UART_IsCommandAvailable(void)
 {
 	uint16_t DmaLength;
@@ -508,6 +743,42 @@ void UART_HandleCommand(void)
 		CMD_052F(UART_Command.Buffer);
 		break;
 
+	case 0x0531:
+		CMD_0531();
+		break;
+
+	case 0x0533:
+		CMD_0533();
+		break;
+
+	case 0x0535:
+		CMD_0535();
+		break;
+
+	case 0x0537:
+		CMD_0537();
+		break;
+
+	case 0x0539:
+		CMD_0539();
+		break;
+
+	case 0x053B:
+		CMD_053B();
+		break;
+
+	case 0x053D:
+		CMD_053D(UART_Command.Buffer);
+		break;
+
+	case 0x053F:
+		CMD_053F();
+		break;
+
+	case 0x0541:
+		CMD_0541();
+		break;
+
 	case 0x05DD:
 		overlay_FLASH_RebootToBootloader();
 		break;
@@ -19,6 +19,7 @@
 
 #include <stdbool.h>
 
+bool UART_IsDataPending(void);
 bool UART_IsCommandAvailable(void);
 void UART_HandleCommand(void);
 
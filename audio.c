@@ -14,6 +14,7 @@
  *     limitations under the License.
  */
 
+#include <stddef.h>
 #include "app/fm.h"
 #include "audio.h"
 #include "bsp/dp32g030/gpio.h"
@@ -59,12 +60,57 @@ volatile bool gFlagPlayQueuedVoice;
 VOICE_ID_t gAnotherVoiceID = VOICE_ID_INVALID;
 BEEP_Type_t gBeepToPlay;
 
-void AUDIO_PlayBeep(BEEP_Type_t Beep)
+static const BEEP_Step_t BeepSingle[] = {
+	{ BEEP_STEP_TONE,	6 },
+	{ BEEP_STEP_UNMUTE,	6 },
+	{ BEEP_STEP_MUTE,	2 },
+	{ BEEP_STEP_PATH_OFF,	1 },
+	{ BEEP_STEP_TONE_OFF,	1 },
+	{ BEEP_STEP_END,	0 },
+};
+
+static const BEEP_Step_t BeepDouble[] = {
+	{ BEEP_STEP_TONE,	6 },
+	{ BEEP_STEP_UNMUTE,	6 },
+	{ BEEP_STEP_MUTE,	2 },
+	{ BEEP_STEP_UNMUTE,	6 },
+	{ BEEP_STEP_MUTE,	2 },
+	{ BEEP_STEP_PATH_OFF,	1 },
+	{ BEEP_STEP_TONE_OFF,	1 },
+	{ BEEP_STEP_END,	0 },
+};
+
+static const BEEP_Step_t BeepLong[] = {
+	{ BEEP_STEP_TONE,	6 },
+	{ BEEP_STEP_UNMUTE,	50 },
+	{ BEEP_STEP_MUTE,	2 },
+	{ BEEP_STEP_PATH_OFF,	1 },
+	{ BEEP_STEP_TONE_OFF,	1 },
+	{ BEEP_STEP_END,	0 },
+};
+
+static const BEEP_Step_t *gBeepStep;
+static uint8_t gBeepCountdown;
+static uint16_t gBeepFrequency;
+static uint16_t gBeepToneConfig;
+
+static void AUDIO_RestoreAfterBeep(void)
 {
-	uint16_t ToneConfig;
-	uint16_t ToneFrequency;
-	uint16_t Duration;
+	BK4819_WriteRegister(BK4819_REG_71, gBeepToneConfig);
+	if (gEnableSpeaker) {
+		GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_AUDIO_PATH);
+	}
+	if (gFmRadioMode) {
+		BK1080_Mute(false);
+	}
+	if (gCurrentFunction == FUNCTION_POWER_SAVE && gThisCanEnable_BK4819_Rxon) {
+		BK4819_Sleep();
+	}
+	gBeepStep = NULL;
+}
 
+void AUDIO_PlayBeep(BEEP_Type_t Beep)
+{
 	if (Beep != BEEP_500HZ_60MS_DOUBLE_BEEP && Beep != BEEP_440HZ_500MS && !gEeprom.BEEP_CONTROL) {
 		return;
 	}
@@ -79,97 +125,173 @@ void AUDIO_PlayBeep(BEEP_Type_t Beep)
 		return;
 	}
 
-	ToneConfig = BK4819_GetRegister(BK4819_REG_71);
-
-	GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_AUDIO_PATH);
-
-	if (gCurrentFunction == FUNCTION_POWER_SAVE && gThisCanEnable_BK4819_Rxon) {
-		BK4819_RX_TurnOn();
-	}
-
-	if (gFmRadioMode) {
-		BK1080_Mute(true);
-	}
-	SYSTEM_DelayMs(20);
 	switch (Beep) {
 	case BEEP_1KHZ_60MS_OPTIONAL:
-		ToneFrequency = 1000;
+		gBeepFrequency = 1000;
 		break;
 	case BEEP_500HZ_60MS_DOUBLE_BEEP_OPTIONAL:
 	case BEEP_500HZ_60MS_DOUBLE_BEEP:
-		ToneFrequency = 500;
+		gBeepFrequency = 500;
 		break;
 	default:
-		ToneFrequency = 440;
+		gBeepFrequency = 440;
 		break;
 	}
-	BK4819_PlayTone(ToneFrequency, true);
-	SYSTEM_DelayMs(2);
-	GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_AUDIO_PATH);
-	SYSTEM_DelayMs(60);
+
+	// A beep requested while another one plays restarts the tone
+	// without saving the already modified tone register again.
+	if (gBeepStep) {
+		BK4819_EnterTxMute();
+		gBeepCountdown = 1;
+	} else {
+		gBeepToneConfig = BK4819_GetRegister(BK4819_REG_71);
+		GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_AUDIO_PATH);
+		if (gCurrentFunction == FUNCTION_POWER_SAVE && gThisCanEnable_BK4819_Rxon) {
+			BK4819_RX_TurnOn();
+		}
+		if (gFmRadioMode) {
+			BK1080_Mute(true);
+		}
+		gBeepCountdown = 2;
+	}
 
 	switch (Beep) {
 	case BEEP_500HZ_60MS_DOUBLE_BEEP_OPTIONAL:
 	case BEEP_500HZ_60MS_DOUBLE_BEEP:
-		BK4819_ExitTxMute();
-		SYSTEM_DelayMs(60);
-		BK4819_EnterTxMute();
-		SYSTEM_DelayMs(20);
-		// Fallthrough
+		gBeepStep = BeepDouble;
+		break;
 	case BEEP_1KHZ_60MS_OPTIONAL:
-		BK4819_ExitTxMute();
-		Duration = 60;
+		gBeepStep = BeepSingle;
 		break;
-	case BEEP_440HZ_500MS:
 	default:
-		BK4819_ExitTxMute();
-		Duration = 500;
+		gBeepStep = BeepLong;
 		break;
 	}
+}
 
-	SYSTEM_DelayMs(Duration);
+void AUDIO_StopBeep(void)
+{
+	if (!gBeepStep) {
+		return;
+	}
 	BK4819_EnterTxMute();
-	SYSTEM_DelayMs(20);
 	GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_AUDIO_PATH);
-
 	g_200003B6 = 80;
-
-	SYSTEM_DelayMs(5);
 	BK4819_TurnsOffTones_TurnsOnRX();
-	SYSTEM_DelayMs(5);
-	BK4819_WriteRegister(BK4819_REG_71, ToneConfig);
-	if (gEnableSpeaker) {
-		GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_AUDIO_PATH);
+	AUDIO_RestoreAfterBeep();
+}
+
+void AUDIO_WaitForBeep(void)
+{
+	while (gBeepStep) {
+		SYSTEM_DelayMs(10);
+		AUDIO_TimeSlice10ms();
 	}
-	if (gFmRadioMode) {
-		BK1080_Mute(false);
+}
+
+bool AUDIO_IsBeepPlaying(void)
+{
+	return gBeepStep != NULL;
+}
+
+void AUDIO_TimeSlice10ms(void)
+{
+	if (!gBeepStep) {
+		return;
 	}
-	if (gCurrentFunction == FUNCTION_POWER_SAVE && gThisCanEnable_BK4819_Rxon) {
-		BK4819_Sleep();
+	if (gBeepCountdown) {
+		gBeepCountdown--;
+		if (gBeepCountdown) {
+			return;
+		}
+	}
+
+	switch (gBeepStep->Step) {
+	case BEEP_STEP_TONE:
+		BK4819_PlayTone(gBeepFrequency, true);
+		SYSTEM_DelayMs(2);
+		GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_AUDIO_PATH);
+		break;
+	case BEEP_STEP_UNMUTE:
+		BK4819_ExitTxMute();
+		break;
+	case BEEP_STEP_MUTE:
+		BK4819_EnterTxMute();
+		break;
+	case BEEP_STEP_PATH_OFF:
+		GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_AUDIO_PATH);
+		g_200003B6 = 80;
+		break;
+	case BEEP_STEP_TONE_OFF:
+		BK4819_TurnsOffTones_TurnsOnRX();
+		break;
+	default:
+		AUDIO_RestoreAfterBeep();
+		return;
+	}
+
+	gBeepCountdown = gBeepStep->Delay;
+	gBeepStep++;
+}
+
+static uint8_t gVoiceBitCount;
+static bool gVoiceClockHigh;
+static uint8_t gVoiceBits;
+static uint32_t gVoiceDeadline;
+
+static void AUDIO_WaitForVoiceID(void)
+{
+	while (gVoiceBitCount) {
+		AUDIO_ShiftVoiceID();
 	}
 }
 
 void AUDIO_PlayVoice(uint8_t VoiceID)
 {
-	uint8_t i;
+	AUDIO_WaitForVoiceID();
 
+	gVoiceBits = VoiceID;
+	gVoiceBitCount = 9;
+	gVoiceClockHigh = true;
+	gVoiceDeadline = SYSTICK_GetMicroseconds() + 7000;
 	GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_VOICE_0);
-	SYSTEM_DelayMs(7);
-	GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_VOICE_0);
-	for (i = 0; i < 8; i++) {
-		if ((VoiceID & 0x80U) == 0) {
-			GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_VOICE_1);
+}
+
+void AUDIO_ShiftVoiceID(void)
+{
+	uint32_t Now;
+
+	if (!gVoiceBitCount) {
+		return;
+	}
+
+	Now = SYSTICK_GetMicroseconds();
+	if ((int32_t)(Now - gVoiceDeadline) >= 0) {
+		gVoiceDeadline = Now + 1200;
+		if (gVoiceClockHigh) {
+			GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_VOICE_0);
+			gVoiceClockHigh = false;
+			gVoiceBitCount--;
+			if (gVoiceBitCount) {
+				if ((gVoiceBits & 0x80U) == 0) {
+					GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_VOICE_1);
+				} else {
+					GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_VOICE_1);
+				}
+				gVoiceBits <<= 1;
+			}
 		} else {
-			GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_VOICE_1);
+			GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_VOICE_0);
+			gVoiceClockHigh = true;
 		}
-		SYSTICK_DelayUs(1200);
-		GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_VOICE_0);
-		SYSTICK_DelayUs(1200);
-		GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_VOICE_0);
-		VoiceID <<= 1;
 	}
 }
 
+bool AUDIO_IsVoiceSending(void)
+{
+	return gVoiceBitCount != 0;
+}
+
 void AUDIO_PlaySingleVoice(bool bFlag)
 {
 	uint8_t VoiceID;
@@ -193,6 +315,7 @@ void AUDIO_PlaySingleVoice(bool bFlag)
 			VoiceID += VOICE_ID_ENG_BASE;
 		}
 
+		AUDIO_WaitForBeep();
 		if (gCurrentFunction == FUNCTION_RECEIVE || gCurrentFunction == FUNCTION_MONITOR) {
 			BK4819_SetAF(BK4819_AF_MUTE);
 		}
@@ -207,6 +330,7 @@ void AUDIO_PlaySingleVoice(bool bFlag)
 			Delay += 3;
 		}
 		if (bFlag) {
+			AUDIO_WaitForVoiceID();
 			SYSTEM_DelayMs(Delay * 10);
 			if (gCurrentFunction == FUNCTION_RECEIVE || gCurrentFunction == FUNCTION_MONITOR) {
 				if (gRxInfo->IsAM) {
@@ -30,6 +30,20 @@ enum BEEP_Type_t {
 
 typedef enum BEEP_Type_t BEEP_Type_t;
 
+enum {
+	BEEP_STEP_END = 0U,
+	BEEP_STEP_TONE,
+	BEEP_STEP_UNMUTE,
+	BEEP_STEP_MUTE,
+	BEEP_STEP_PATH_OFF,
+	BEEP_STEP_TONE_OFF,
+};
+
+typedef struct {
+	uint8_t Step;
+	uint8_t Delay;
+} BEEP_Step_t;
+
 enum {
 	VOICE_ID_CHI_BASE		= 0x10U,
 	VOICE_ID_ENG_BASE		= 0x60U,
@@ -127,7 +141,13 @@ extern VOICE_ID_t gAnotherVoiceID;
 extern BEEP_Type_t gBeepToPlay;
 
 void AUDIO_PlayBeep(BEEP_Type_t Beep);
+void AUDIO_StopBeep(void);
+void AUDIO_WaitForBeep(void);
+bool AUDIO_IsBeepPlaying(void);
+void AUDIO_TimeSlice10ms(void);
 void AUDIO_PlayVoice(uint8_t VoiceID);
+void AUDIO_ShiftVoiceID(void);
+bool AUDIO_IsVoiceSending(void);
 void AUDIO_PlaySingleVoice(bool bFlag);
 void AUDIO_SetVoiceID(uint8_t Index, VOICE_ID_t VoiceID);
 uint8_t AUDIO_SetDigitVoice(uint8_t Index, uint16_t Value);
@@ -302,7 +302,7 @@ void BOARD_ADC_Init(void)
 	Config.CLK_SEL = SYSCON_CLK_SEL_W_SARADC_SMPL_VALUE_DIV2;
 	Config.CH_SEL = ADC_CH4 | ADC_CH9;
 	Config.AVG = SARADC_CFG_AVG_VALUE_8_SAMPLE;
-	Config.CONT = SARADC_CFG_CONT_VALUE_SINGLE;
+	Config.CONT = SARADC_CFG_CONT_VALUE_CONTINUOUS;
 	Config.MEM_MODE = SARADC_CFG_MEM_MODE_VALUE_CHANNEL;
 	Config.SMPL_CLK = SARADC_CFG_SMPL_CLK_VALUE_INTERNAL;
 	Config.SMPL_WIN = SARADC_CFG_SMPL_WIN_VALUE_15_CYCLE;
@@ -317,14 +317,38 @@ void BOARD_ADC_Init(void)
 	ADC_Configure(&Config);
 	ADC_Enable();
 	ADC_SoftReset();
+	// Free running from here on, the channel registers always hold the
+	// latest averaged conversion.
+	ADC_Start();
+	while (!ADC_CheckEndOfConversion(ADC_CH9)) {
+	}
 }
 
-void BOARD_ADC_GetBatteryInfo(uint16_t *pVoltage, uint16_t *pCurrent)
+void BOARD_ADC_Start(void)
 {
+	// Clears the end of conversion left from before the stop
+	ADC_GetValue(ADC_CH9);
+	ADC_Enable();
 	ADC_Start();
-
 	while (!ADC_CheckEndOfConversion(ADC_CH9)) {
 	}
+}
+
+void BOARD_ADC_Stop(void)
+{
+	ADC_Disable();
+}
+
+void BOARD_ADC_GetBatteryInfo(uint16_t *pVoltage, uint16_t *pCurrent)
+{
+	if ((SARADC_CFG & SARADC_CFG_ADC_EN_MASK) == SARADC_CFG_ADC_EN_BITS_DISABLE) {
+		// Stopped for power save, convert once
+		BOARD_ADC_Start();
+		*pVoltage = ADC_GetValue(ADC_CH4);
+		*pCurrent = ADC_GetValue(ADC_CH9);
+		BOARD_ADC_Stop();
+		return;
+	}
 	*pVoltage = ADC_GetValue(ADC_CH4);
 	*pCurrent = ADC_GetValue(ADC_CH9);
 }
@@ -405,10 +429,10 @@ void BOARD_EEPROM_Init(void)
 	// 0E90..0E97
 	EEPROM_ReadBuffer(0x0E90, Data, 8);
 	gEeprom.BEEP_CONTROL             = (Data[0] < 2) ? Data[0] : true;
-	gEeprom.KEY_1_SHORT_PRESS_ACTION = (Data[1] < 9) ? Data[1] : 3;
-	gEeprom.KEY_1_LONG_PRESS_ACTION  = (Data[2] < 9) ? Data[2] : 8;
-	gEeprom.KEY_2_SHORT_PRESS_ACTION = (Data[3] < 9) ? Data[3] : 1;
-	gEeprom.KEY_2_LONG_PRESS_ACTION  = (Data[4] < 9) ? Data[4] : 6;
+	gEeprom.KEY_1_SHORT_PRESS_ACTION = (Data[1] < 11) ? Data[1] : 3;
+	gEeprom.KEY_1_LONG_PRESS_ACTION  = (Data[2] < 11) ? Data[2] : 8;
+	gEeprom.KEY_2_SHORT_PRESS_ACTION = (Data[3] < 11) ? Data[3] : 1;
+	gEeprom.KEY_2_LONG_PRESS_ACTION  = (Data[4] < 11) ? Data[4] : 6;
 	gEeprom.SCAN_RESUME_MODE         = (Data[5] < 3) ? Data[5] : SCAN_RESUME_CO;
 	gEeprom.AUTO_KEYPAD_LOCK         = (Data[6] < 2) ? Data[6] : true;
 	gEeprom.POWER_ON_DISPLAY_MODE    = (Data[7] < 3) ? Data[7] : POWER_ON_DISPLAY_MODE_MESSAGE;
@@ -519,6 +543,9 @@ void BOARD_EEPROM_Init(void)
 
 	// 0D60..0E27
 	EEPROM_ReadBuffer(0x0D60, gMR_ChannelAttributes, sizeof(gMR_ChannelAttributes));
+	for (i = MR_CHANNEL_FIRST; i <= MR_CHANNEL_LAST; i++) {
+		RADIO_UpdateChannelBitmap(i);
+	}
 
 	// 0F30..0F3F
 	EEPROM_ReadBuffer(0x0F30, gCustomAesKey, sizeof(gCustomAesKey));
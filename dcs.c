@@ -63,26 +63,47 @@ const uint16_t DCS_Options[104] = {
 	0x01DA, 0x01DC, 0x01E3, 0x01EC,
 };
 
-static uint32_t DCS_CalculateGolay(uint32_t CodeWord)
-{
-	uint32_t Word;
-	uint8_t i;
+// Golay (23,12) parity of each entry of DCS_Options, bits 12..22 of the
+// code word. Generated offline with the 0x08EA polynomial.
+static const uint16_t DCS_Parity[104] = {
+	0x0763, 0x06B7, 0x065D, 0x051F,
+	0x05F5, 0x00BE, 0x05B6, 0x00FD,
+	0x07CA, 0x0355, 0x06F4, 0x05D1,
+	0x0679, 0x0693, 0x02E6, 0x0747,
+	0x035E, 0x072B, 0x07C1, 0x05DA,
+	0x007B, 0x03D3, 0x0339, 0x02ED,
+	0x037A, 0x02AE, 0x01EC, 0x044D,
+	0x04A7, 0x06BC, 0x031D, 0x005F,
+	0x018B, 0x06E9, 0x05AB, 0x068E,
+	0x075A, 0x07B0, 0x045B, 0x01FA,
+	0x058F, 0x0565, 0x0627, 0x06CD,
+	0x036C, 0x0177, 0x05E8, 0x043C,
+	0x04D6, 0x0794, 0x06AA, 0x00CF,
+	0x038D, 0x06C6, 0x0196, 0x023E,
+	0x02D4, 0x0297, 0x03A9, 0x00EB,
+	0x054A, 0x0685, 0x02F0, 0x0158,
+	0x0776, 0x079C, 0x03E9, 0x04B9,
+	0x06C5, 0x062F, 0x07B8, 0x0752,
+	0x04FA, 0x052E, 0x015B, 0x03AA,
+	0x027E, 0x060B, 0x06E1, 0x03C6,
+	0x02F8, 0x041B, 0x0275, 0x034B,
+	0x00E3, 0x019E, 0x00C7, 0x05D9,
+	0x0671, 0x00F5, 0x001F, 0x0728,
+	0x07C2, 0x04C3, 0x0247, 0x0393,
+	0x022B, 0x00BD, 0x0398, 0x01E4,
+	0x010E, 0x00DA, 0x014D, 0x020F,
+};
 
-	Word = CodeWord;
-	for (i = 0; i < 12; i++) {
-		Word <<= 1;
-		if (Word & 0x1000) {
-			Word ^= 0x08EA;
-		}
-	}
-	return CodeWord | ((Word & 0x0FFE) << 11);
+static uint32_t DCS_GetCodeWord(uint8_t Option)
+{
+	return ((uint32_t)DCS_Parity[Option] << 12) | 0x800U | DCS_Options[Option];
 }
 
 uint32_t DCS_GetGolayCodeWord(DCS_CodeType_t CodeType, uint8_t Option)
 {
 	uint32_t Code;
 
-	Code = DCS_CalculateGolay(DCS_Options[Option] + 0x800U);
+	Code = DCS_GetCodeWord(Option);
 	if (CodeType == CODE_TYPE_REVERSE_DIGITAL) {
 		Code ^= 0x7FFFFF;
 	}
@@ -90,29 +111,41 @@ uint32_t DCS_GetGolayCodeWord(DCS_CodeType_t CodeType, uint8_t Option)
 	return Code;
 }
 
+static uint8_t DCS_FindOption(uint16_t Option)
+{
+	uint8_t Low = 0;
+	uint8_t High = ARRAY_SIZE(DCS_Options);
+
+	// DCS_Options is sorted
+	while (Low < High) {
+		const uint8_t Middle = (Low + High) / 2U;
+
+		if (DCS_Options[Middle] < Option) {
+			Low = Middle + 1U;
+		} else {
+			High = Middle;
+		}
+	}
+	if (Low < ARRAY_SIZE(DCS_Options) && DCS_Options[Low] == Option) {
+		return Low;
+	}
+
+	return 0xFF;
+}
+
 uint8_t DCS_GetCdcssIndex(uint32_t Code)
 {
 	uint8_t i;
 
 	for (i = 0; i < 23; i++) {
-		uint32_t Shift;
-
 		if (((Code >> 9) & 0x7U) == 4) {
-			uint8_t j;
-
-			for (j = 0; j < ARRAY_SIZE(DCS_Options); j++) {
-				if (DCS_Options[j] == (Code & 0x1FF)) {
-					if (DCS_GetGolayCodeWord(2, j) == Code) {
-						return j;
-					}
-				}
+			const uint8_t j = DCS_FindOption(Code & 0x1FF);
+
+			if (j != 0xFF && DCS_GetCodeWord(j) == Code) {
+				return j;
 			}
 		}
-		Shift = Code >> 1;
-		if (Code & 1U) {
-			Shift |= 0x400000U;
-		}
-		Code = Shift;
+		Code = (Code >> 1) | ((Code & 1U) << 22);
 	}
 
 	return 0xFF;
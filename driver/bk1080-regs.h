@@ -24,6 +24,7 @@ enum BK1080_Register_t {
 	BK1080_REG_05_SYSTEM_CONFIGURATION2 = 0x05U,
 	BK1080_REG_07                       = 0x07U,
 	BK1080_REG_10                       = 0x0AU,
+	BK1080_REG_11                       = 0x0BU,
 	BK1080_REG_25_INTERNAL              = 0x19U,
 };
 
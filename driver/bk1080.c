@@ -114,3 +114,29 @@ void BK1080_GetFrequencyDeviation(uint16_t Frequency)
 	BK1080_FrequencyDeviation = (int16_t)BK1080_ReadRegister(BK1080_REG_07) / 16;
 }
 
+void BK1080_StartSeek(void)
+{
+	// SEEK has to go low first to clear STC from the previous seek
+	BK1080_WriteRegister(BK1080_REG_02_POWER_CONFIGURATION, 0x0601);
+	BK1080_WriteRegister(BK1080_REG_02_POWER_CONFIGURATION, 0x0701);
+}
+
+void BK1080_StopSeek(void)
+{
+	BK1080_WriteRegister(BK1080_REG_02_POWER_CONFIGURATION, 0x0201);
+}
+
+bool BK1080_IsSeekComplete(bool *pBandLimit)
+{
+	uint16_t Status;
+
+	Status = BK1080_ReadRegister(BK1080_REG_10);
+	*pBandLimit = (Status & 0x2000) != 0;
+
+	return (Status & 0x4000) != 0;
+}
+
+uint16_t BK1080_GetFrequency(void)
+{
+	return (BK1080_ReadRegister(BK1080_REG_11) & 0x03FF) + 760;
+}
@@ -30,6 +30,10 @@ void BK1080_WriteRegister(BK1080_Register_t Register, uint16_t Value);
 void BK1080_Mute(bool Mute);
 void BK1080_SetFrequency(uint16_t Frequency);
 void BK1080_GetFrequencyDeviation(uint16_t Frequency);
+void BK1080_StartSeek(void);
+void BK1080_StopSeek(void);
+bool BK1080_IsSeekComplete(bool *pBandLimit);
+uint16_t BK1080_GetFrequency(void);
 
 #endif
 
@@ -21,12 +21,21 @@
 #include "driver/system.h"
 #include "driver/systick.h"
 
+// Loops of 4 cycles per bus half period, ~83 ns each at 48 MHz. The
+// default gives a ~1.5 MHz SCL including the GPIO call overhead.
+#if !defined(BK4819_SPI_DELAY)
+#define BK4819_SPI_DELAY 3
+#endif
+
+#define BK4819_Delay() SYSTICK_DelayLoops(BK4819_SPI_DELAY)
+
 static const uint16_t FSK_RogerTable[7] = {
 	0xF1A2, 0x7446, 0x61A4, 0x6544,
 	0x4E8A, 0xE044, 0xEA84,
 };
 
 static uint16_t gBK4819_GpioOutState;
+static uint16_t gBK4819_InterruptMask;
 
 bool gThisCanEnable_BK4819_Rxon;
 
@@ -74,16 +83,16 @@ static uint16_t BK4819_ReadU16(void)
 
 	PORTCON_PORTC_IE = (PORTCON_PORTC_IE & ~PORTCON_PORTC_IE_C2_MASK) | PORTCON_PORTC_IE_C2_BITS_ENABLE;
 	GPIOC->DIR = (GPIOC->DIR & ~GPIO_DIR_2_MASK) | GPIO_DIR_2_BITS_INPUT;
-	SYSTICK_DelayUs(1);
+	BK4819_Delay();
 
 	Value = 0;
 	for (i = 0; i < 16; i++) {
 		Value <<= 1;
 		Value |= GPIO_CheckBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SDA);
 		GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCL);
-		SYSTICK_DelayUs(1);
+		BK4819_Delay();
 		GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCL);
-		SYSTICK_DelayUs(1);
+		BK4819_Delay();
 	}
 	PORTCON_PORTC_IE = (PORTCON_PORTC_IE & ~PORTCON_PORTC_IE_C2_MASK) | PORTCON_PORTC_IE_C2_BITS_DISABLE;
 	GPIOC->DIR = (GPIOC->DIR & ~GPIO_DIR_2_MASK) | GPIO_DIR_2_BITS_OUTPUT;
@@ -97,7 +106,7 @@ uint16_t BK4819_GetRegister(BK4819_REGISTER_t Register)
 
 	GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCN);
 	GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCL);
-	SYSTICK_DelayUs(1);
+	BK4819_Delay();
 	GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCN);
 
 	BK4819_WriteU8(Register | 0x80);
@@ -105,7 +114,7 @@ uint16_t BK4819_GetRegister(BK4819_REGISTER_t Register)
 	Value = BK4819_ReadU16();
 
 	GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCN);
-	SYSTICK_DelayUs(1);
+	BK4819_Delay();
 	GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCL);
 	GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SDA);
 
@@ -116,16 +125,30 @@ void BK4819_WriteRegister(BK4819_REGISTER_t Register, uint16_t Data)
 {
 	GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCN);
 	GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCL);
-	SYSTICK_DelayUs(1);
+	BK4819_Delay();
 	GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCN);
 	BK4819_WriteU8(Register);
-	SYSTICK_DelayUs(1);
+	BK4819_Delay();
 	BK4819_WriteU16(Data);
-	SYSTICK_DelayUs(1);
+	BK4819_Delay();
 	GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCN);
-	SYSTICK_DelayUs(1);
+	BK4819_Delay();
 	GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCL);
 	GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SDA);
+	if (Register == BK4819_REG_3F) {
+		gBK4819_InterruptMask = Data;
+	}
+}
+
+bool BK4819_IsInterruptPending(void)
+{
+	// The IRQ pin is not routed to the MCU, so only touch the bus when
+	// something can actually raise it.
+	if (!gBK4819_InterruptMask) {
+		return false;
+	}
+
+	return BK4819_GetRegister(BK4819_REG_0C) & 1U;
 }
 
 void BK4819_WriteU8(uint8_t Data)
@@ -139,12 +162,12 @@ void BK4819_WriteU8(uint8_t Data)
 		} else {
 			GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SDA);
 		}
-		SYSTICK_DelayUs(1);
+		BK4819_Delay();
 		GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCL);
-		SYSTICK_DelayUs(1);
+		BK4819_Delay();
 		Data <<= 1;
 		GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCL);
-		SYSTICK_DelayUs(1);
+		BK4819_Delay();
 	}
 }
 
@@ -159,12 +182,12 @@ void BK4819_WriteU16(uint16_t Data)
 		} else {
 			GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SDA);
 		}
-		SYSTICK_DelayUs(1);
+		BK4819_Delay();
 		GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCL);
 		Data <<= 1;
-		SYSTICK_DelayUs(1);
+		BK4819_Delay();
 		GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCL);
-		SYSTICK_DelayUs(1);
+		BK4819_Delay();
 	}
 }
 
@@ -324,6 +347,14 @@ void BK4819_SetFrequency(uint32_t Frequency)
 	BK4819_WriteRegister(BK4819_REG_39, (Frequency >> 16) & 0xFFFF);
 }
 
+void BK4819_RetuneRX(uint32_t Frequency)
+{
+	BK4819_SetFrequency(Frequency);
+	// Restart the RX chain so the PLL relocks on the new frequency
+	BK4819_WriteRegister(BK4819_REG_30, 0);
+	BK4819_WriteRegister(BK4819_REG_30, 0xBFF1);
+}
+
 void BK4819_SetupSquelch(uint8_t SquelchOpenRSSIThresh, uint8_t SquelchCloseRSSIThresh, uint8_t SquelchOpenNoiseThresh, uint8_t SquelchCloseNoiseThresh, uint8_t SquelchCloseGlitchThresh, uint8_t SquelchOpenGlitchThresh)
 {
 	BK4819_WriteRegister(BK4819_REG_70, 0);
@@ -664,27 +695,6 @@ void BK4819_PlayDTMF(char Code)
 	}
 }
 
-void BK4819_PlayDTMFString(const char *pString, bool bDelayFirst, uint16_t FirstCodePersistTime, uint16_t HashCodePersistTime, uint16_t CodePersistTime, uint16_t CodeInternalTime)
-{
-	uint8_t i;
-	uint16_t Delay;
-
-	for (i = 0; pString[i]; i++) {
-		BK4819_PlayDTMF(pString[i]);
-		BK4819_ExitTxMute();
-		if (bDelayFirst && i == 0) {
-			Delay = FirstCodePersistTime;
-		} else if (pString[i] == '*' || pString[i] == '#') {
-			Delay = HashCodePersistTime;
-		} else {
-			Delay = CodePersistTime;
-		}
-		SYSTEM_DelayMs(Delay);
-		BK4819_EnterTxMute();
-		SYSTEM_DelayMs(CodeInternalTime);
-	}
-}
-
 void BK4819_TransmitTone(bool bLocalLoopback, uint32_t Frequency)
 {
 	BK4819_EnterTxMute();
@@ -827,14 +837,9 @@ uint8_t BK4819_GetCTCType(void)
         return (BK4819_GetRegister(BK4819_REG_0C) >> 10) & 3;
 }
 
-void BK4819_SendFSKData(uint16_t *pData)
+void BK4819_LoadFSKData(const uint16_t *pData)
 {
 	uint8_t i;
-	uint8_t Timeout;
-
-	Timeout = 200;
-
-	SYSTEM_DelayMs(20);
 
 	BK4819_WriteRegister(BK4819_REG_3F, BK4819_REG_3F_FSK_TX_FINISHED);
 	BK4819_WriteRegister(BK4819_REG_59, 0x8068);
@@ -843,22 +848,18 @@ void BK4819_SendFSKData(uint16_t *pData)
 	for (i = 0; i < 36; i++) {
 		BK4819_WriteRegister(BK4819_REG_5F, pData[i]);
 	}
+}
 
-	SYSTEM_DelayMs(20);
-
+void BK4819_StartFSKTransmit(void)
+{
 	BK4819_WriteRegister(BK4819_REG_59, 0x2868);
+}
 
-	while (Timeout) {
-		if (BK4819_GetRegister(BK4819_REG_0C) & 1U) {
-			break;
-		}
-		SYSTEM_DelayMs(5);
-		Timeout--;
-	}
-
+void BK4819_StopFSKTransmit(void)
+{
 	BK4819_WriteRegister(BK4819_REG_02, 0);
-	SYSTEM_DelayMs(20);
-	BK4819_ResetFSK();
+	BK4819_WriteRegister(BK4819_REG_3F, 0x0000);
+	BK4819_WriteRegister(BK4819_REG_59, 0x0068);
 }
 
 void BK4819_PrepareFSKReceive(void)
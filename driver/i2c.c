@@ -20,68 +20,90 @@
 #include "driver/i2c.h"
 #include "driver/systick.h"
 
+// Delay loops of 4 cycles at 48 MHz, on top of ~0.2 us of GPIO call
+// overhead per edge. Sized for the fast mode minimums of tLOW 1.3 us and
+// tHIGH/tSU/tHD 0.6 us, giving a ~350 kHz SCL.
+#if !defined(I2C_DELAY_LOW)
+#define I2C_DELAY_LOW 15
+#endif
+#if !defined(I2C_DELAY_HIGH)
+#define I2C_DELAY_HIGH 8
+#endif
+
+#define I2C_DelayLow() SYSTICK_DelayLoops(I2C_DELAY_LOW)
+#define I2C_DelayHigh() SYSTICK_DelayLoops(I2C_DELAY_HIGH)
+
+// Port register images with SDA as output [0] or input [1], captured at
+// every start condition. Nothing else changes these registers at runtime.
+static uint32_t gI2C_IE[2];
+static uint32_t gI2C_OD[2];
+static uint32_t gI2C_DIR[2];
+
+static void I2C_SetSdaInput(bool bInput)
+{
+	PORTCON_PORTA_IE = gI2C_IE[bInput];
+	PORTCON_PORTA_OD = gI2C_OD[bInput];
+	GPIOA->DIR = gI2C_DIR[bInput];
+}
+
 void I2C_Start(void)
 {
+	gI2C_IE[0] = PORTCON_PORTA_IE & ~PORTCON_PORTA_IE_A11_MASK;
+	gI2C_IE[1] = gI2C_IE[0] | PORTCON_PORTA_IE_A11_BITS_ENABLE;
+	gI2C_OD[1] = PORTCON_PORTA_OD & ~PORTCON_PORTA_OD_A11_MASK;
+	gI2C_OD[0] = gI2C_OD[1] | PORTCON_PORTA_OD_A11_BITS_ENABLE;
+	gI2C_DIR[1] = GPIOA->DIR & ~GPIO_DIR_11_MASK;
+	gI2C_DIR[0] = gI2C_DIR[1] | GPIO_DIR_11_BITS_OUTPUT;
+
 	GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_I2C_SDA);
-	SYSTICK_DelayUs(1);
+	I2C_DelayHigh();
 	GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
-	SYSTICK_DelayUs(1);
+	I2C_DelayHigh();
 	GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_I2C_SDA);
-	SYSTICK_DelayUs(1);
+	I2C_DelayHigh();
 	GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
-	SYSTICK_DelayUs(1);
+	I2C_DelayLow();
 }
 
 void I2C_Stop(void)
 {
 	GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_I2C_SDA);
-	SYSTICK_DelayUs(1);
 	GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
-	SYSTICK_DelayUs(1);
+	I2C_DelayLow();
 	GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
-	SYSTICK_DelayUs(1);
+	I2C_DelayHigh();
 	GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_I2C_SDA);
-	SYSTICK_DelayUs(1);
+	I2C_DelayLow();
 }
 
 uint8_t I2C_Read(bool bFinal)
 {
 	uint8_t i, Data;
 
-	PORTCON_PORTA_IE |= PORTCON_PORTA_IE_A11_BITS_ENABLE;
-	PORTCON_PORTA_OD &= ~PORTCON_PORTA_OD_A11_MASK;
-	GPIOA->DIR &= ~GPIO_DIR_11_MASK;
+	I2C_SetSdaInput(true);
 
 	Data = 0;
 	for (i = 0; i < 8; i++) {
-		GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
-		SYSTICK_DelayUs(1);
+		I2C_DelayLow();
 		GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
-		SYSTICK_DelayUs(1);
+		I2C_DelayHigh();
 		Data <<= 1;
-		SYSTICK_DelayUs(1);
 		if (GPIO_CheckBit(&GPIOA->DATA, GPIOA_PIN_I2C_SDA)) {
 			Data |= 1U;
 		}
 		GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
-		SYSTICK_DelayUs(1);
 	}
 
-	PORTCON_PORTA_IE &= ~PORTCON_PORTA_IE_A11_MASK;
-	PORTCON_PORTA_OD |= PORTCON_PORTA_OD_A11_BITS_ENABLE;
-	GPIOA->DIR |= GPIO_DIR_11_BITS_OUTPUT;
-	GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
-	SYSTICK_DelayUs(1);
+	I2C_SetSdaInput(false);
 	if (bFinal) {
 		GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_I2C_SDA);
 	} else {
 		GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_I2C_SDA);
 	}
-	SYSTICK_DelayUs(1);
+	I2C_DelayLow();
 	GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
-	SYSTICK_DelayUs(1);
+	I2C_DelayHigh();
 	GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
-	SYSTICK_DelayUs(1);
 
 	return Data;
 }
@@ -92,7 +114,6 @@ int I2C_Write(uint8_t Data)
 	int ret = -1;
 
 	GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
-	SYSTICK_DelayUs(1);
 	for (i = 0; i < 8; i++) {
 		if ((Data & 0x80) == 0) {
 			GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_I2C_SDA);
@@ -100,20 +121,17 @@ int I2C_Write(uint8_t Data)
 			GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_I2C_SDA);
 		}
 		Data <<= 1;
-		SYSTICK_DelayUs(1);
+		I2C_DelayLow();
 		GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
-		SYSTICK_DelayUs(1);
+		I2C_DelayHigh();
 		GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
-		SYSTICK_DelayUs(1);
 	}
 
-	PORTCON_PORTA_IE |= PORTCON_PORTA_IE_A11_BITS_ENABLE;
-	PORTCON_PORTA_OD &= ~PORTCON_PORTA_OD_A11_MASK;
-	GPIOA->DIR &= ~GPIO_DIR_11_MASK;
+	I2C_SetSdaInput(true);
 	GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_I2C_SDA);
-	SYSTICK_DelayUs(1);
+	I2C_DelayLow();
 	GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
-	SYSTICK_DelayUs(1);
+	I2C_DelayHigh();
 
 	for (i = 0; i < 255; i++) {
 		if (GPIO_CheckBit(&GPIOA->DATA, GPIOA_PIN_I2C_SDA) == 0) {
@@ -123,10 +141,7 @@ int I2C_Write(uint8_t Data)
 	}
 
 	GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
-	SYSTICK_DelayUs(1);
-	PORTCON_PORTA_IE &= ~PORTCON_PORTA_IE_A11_MASK;
-	PORTCON_PORTA_OD |= PORTCON_PORTA_OD_A11_BITS_ENABLE;
-	GPIOA->DIR |= GPIO_DIR_11_BITS_OUTPUT;
+	I2C_SetSdaInput(false);
 	GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_I2C_SDA);
 
 	return ret;
@@ -143,11 +158,9 @@ int I2C_ReadBuffer(void *pBuffer, uint8_t Size)
 	}
 
 	for (i = 0; i < Size - 1; i++) {
-		SYSTICK_DelayUs(1);
 		pData[i] = I2C_Read(false);
 	}
 
-	SYSTICK_DelayUs(1);
 	pData[i++] = I2C_Read(true);
 
 	return Size;
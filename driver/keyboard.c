@@ -25,10 +25,40 @@ KEY_Code_t gKeyReading1;
 uint16_t gDebounceCounter;
 bool gWasFKeyPressed;
 
+static bool KEYBOARD_IsAnyKeyDown(void)
+{
+	const uint32_t Columns = 0
+		| (1U << GPIOA_PIN_KEYBOARD_0)
+		| (1U << GPIOA_PIN_KEYBOARD_1)
+		| (1U << GPIOA_PIN_KEYBOARD_2)
+		| (1U << GPIOA_PIN_KEYBOARD_3)
+		;
+	bool bDown;
+
+	// With every row low any key, side keys included, pulls a column
+	// low, so one read covers the whole keypad. Row 6 is already low.
+	GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_4);
+	GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_5);
+	GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_7);
+	SYSTICK_DelayUs(1);
+
+	bDown = (GPIOA->DATA & Columns) != Columns;
+
+	GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_4);
+	GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_5);
+	GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_7);
+
+	return bDown;
+}
+
 KEY_Code_t KEYBOARD_Poll(void)
 {
 	KEY_Code_t Key = KEY_INVALID;
 
+	if (!KEYBOARD_IsAnyKeyDown()) {
+		return KEY_INVALID;
+	}
+
 	GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_4);
 	GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_5);
 	GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_6);
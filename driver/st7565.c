@@ -74,6 +74,23 @@ void ST7565_BlitFullScreen(void)
 	SPI_ToggleMasterMode(&SPI0->CR, true);
 }
 
+void ST7565_BlitLine(uint8_t Line)
+{
+	uint8_t Column;
+
+	SPI_ToggleMasterMode(&SPI0->CR, false);
+	ST7565_WriteByte(0x40);
+	ST7565_SelectColumnAndLine(4U, Line + 1U);
+	GPIO_SetBit(&GPIOB->DATA, GPIOB_PIN_ST7565_A0);
+	for (Column = 0; Column < 128; Column++) {
+		while ((SPI0->FIFOST & SPI_FIFOST_TFF_MASK) != SPI_FIFOST_TFF_BITS_NOT_FULL) {
+		}
+		SPI0->WDR = gFrameBuffer[Line][Column];
+	}
+	SPI_WaitForUndocumentedTxFifoStatusBit();
+	SPI_ToggleMasterMode(&SPI0->CR, true);
+}
+
 void ST7565_BlitStatusLine(void)
 {
 	uint8_t i;
@@ -25,6 +25,7 @@ extern uint8_t gFrameBuffer[7][128];
 
 void ST7565_DrawLine(uint8_t Column, uint8_t Line, uint16_t Size, const uint8_t *pBitmap, bool bIsClearMode);
 void ST7565_BlitFullScreen(void);
+void ST7565_BlitLine(uint8_t Line);
 void ST7565_BlitStatusLine(void);
 void ST7565_FillScreen(uint8_t Value);
 void ST7565_Init(void);
@@ -14,11 +14,15 @@
  *     limitations under the License.
  */
 
+#include "ARMCM0.h"
 #include "bsp/dp32g030/pmu.h"
 #include "bsp/dp32g030/syscon.h"
+#include "driver/adc.h"
 #include "driver/system.h"
 #include "driver/systick.h"
 
+uint8_t gSystemClockShift;
+
 void SYSTEM_DelayMs(uint32_t Delay)
 {
 	SYSTICK_DelayUs(Delay * 1000);
@@ -38,3 +42,31 @@ void SYSTEM_ConfigureClocks(void)
 	SYSCON_DIV_CLK_GATE = (SYSCON_DIV_CLK_GATE & ~SYSCON_DIV_CLK_GATE_DIV_CLK_GATE_MASK) | SYSCON_DIV_CLK_GATE_DIV_CLK_GATE_BITS_DISABLE;
 }
 
+void SYSTEM_SetClockShift(uint8_t Shift)
+{
+	uint32_t Value;
+
+	if (Shift == gSystemClockShift) {
+		return;
+	}
+
+	// CLK_SEL reads back with a different layout than it is written
+	Value = ADC_GetClockConfig() & ~(SYSCON_CLK_SEL_SYS_MASK | SYSCON_CLK_SEL_DIV_MASK);
+	if (Shift) {
+		Value |= SYSCON_CLK_SEL_SYS_BITS_DIV_CLK | ((uint32_t)Shift << SYSCON_CLK_SEL_DIV_SHIFT);
+		SYSCON_DIV_CLK_GATE = (SYSCON_DIV_CLK_GATE & ~SYSCON_DIV_CLK_GATE_DIV_CLK_GATE_MASK) | SYSCON_DIV_CLK_GATE_DIV_CLK_GATE_BITS_ENABLE;
+	} else {
+		Value |= SYSCON_CLK_SEL_SYS_BITS_RCHF | SYSCON_CLK_SEL_DIV_BITS_2;
+	}
+
+	__disable_irq();
+	SYSCON_CLK_SEL = Value;
+	SYSTICK_SetClockShift(Shift);
+	__enable_irq();
+
+	if (!Shift) {
+		SYSCON_DIV_CLK_GATE = (SYSCON_DIV_CLK_GATE & ~SYSCON_DIV_CLK_GATE_DIV_CLK_GATE_MASK) | SYSCON_DIV_CLK_GATE_DIV_CLK_GATE_BITS_DISABLE;
+	}
+
+	gSystemClockShift = Shift;
+}
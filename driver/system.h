@@ -19,8 +19,19 @@
 
 #include <stdint.h>
 
+#if !defined(SYSTEM_CLOCK_SHIFT_STANDBY)
+#define SYSTEM_CLOCK_SHIFT_STANDBY 4
+#endif
+
+#if SYSTEM_CLOCK_SHIFT_STANDBY > 4
+#error "SYSTEM_CLOCK_SHIFT_STANDBY must be at most 4"
+#endif
+
+extern uint8_t gSystemClockShift;
+
 void SYSTEM_DelayMs(uint32_t Delay);
 void SYSTEM_ConfigureClocks(void);
+void SYSTEM_SetClockShift(uint8_t Shift);
 
 #endif
 
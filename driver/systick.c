@@ -20,6 +20,7 @@
 
 // 0x20000324
 static uint32_t gTickMultiplier;
+static uint8_t gTickShift;
 
 void SYSTICK_Init(void)
 {
@@ -52,3 +53,58 @@ void SYSTICK_DelayUs(uint32_t Delay)
 	} while (i < Delay * gTickMultiplier);
 }
 
+void SYSTICK_SetClockShift(uint8_t Shift)
+{
+	uint32_t Remaining;
+
+	Remaining = SysTick->VAL;
+	if (Shift > gTickShift) {
+		Remaining >>= Shift - gTickShift;
+	} else {
+		Remaining <<= gTickShift - Shift;
+	}
+	if (Remaining < 2) {
+		Remaining = 2;
+	}
+	gTickShift = Shift;
+	gTickMultiplier = 48U >> Shift;
+
+	// Finish the current tick at the new rate so the 10ms phase is kept,
+	// then switch the reload value once the counter has picked it up.
+	SysTick->LOAD = Remaining;
+	SysTick->VAL = 0;
+	while (SysTick->VAL == 0) {
+	}
+	SysTick->LOAD = (480000U >> Shift) - 1U;
+}
+
+uint32_t SYSTICK_GetMicroseconds(void)
+{
+	uint32_t Count;
+	uint32_t Value;
+
+	do {
+		Count = gGlobalSysTickCounter;
+		Value = SysTick->VAL;
+		// With IRQs masked a wrap leaves the tick pending instead of
+		// counted, and VAL has already reloaded.
+		if (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) {
+			Count++;
+			Value = SysTick->VAL;
+		}
+	} while (Count != gGlobalSysTickCounter);
+
+	return (Count * 10000U) + ((SysTick->LOAD - Value) / gTickMultiplier);
+}
+
+uint32_t SYSTICK_GetTickMultiplier(void)
+{
+	return gTickMultiplier;
+}
+
+void SYSTICK_WaitUntil(uint32_t Deadline)
+{
+	while ((int32_t)(SYSTICK_GetMicroseconds() - Deadline) < 0) {
+	}
+}
+
@@ -21,6 +21,24 @@
 
 void SYSTICK_Init(void);
 void SYSTICK_DelayUs(uint32_t Delay);
+void SYSTICK_SetClockShift(uint8_t Shift);
+uint32_t SYSTICK_GetMicroseconds(void);
+uint32_t SYSTICK_GetTickMultiplier(void);
+void SYSTICK_WaitUntil(uint32_t Deadline);
+
+// Busy waits Loops * 4 core cycles (subs + taken bne on the Cortex-M0).
+static inline void SYSTICK_DelayLoops(uint32_t Loops)
+{
+	if (Loops) {
+		__asm volatile (
+			"1:	subs	%0, #1\n"
+			"	bne	1b\n"
+			: "+l" (Loops)
+			:
+			: "cc"
+			);
+	}
+}
 
 #endif
 
@@ -17,6 +17,8 @@
 #include <string.h>
 #include "app/dtmf.h"
 #include "app/fm.h"
+#include "audio.h"
+#include "board.h"
 #include "bsp/dp32g030/gpio.h"
 #include "dcs.h"
 #include "driver/bk1080.h"
@@ -71,12 +73,23 @@ void FUNCTION_Select(FUNCTION_Type_t Function)
 	FUNCTION_Type_t PreviousFunction;
 	bool bWasPowerSave;
 
+	AUDIO_StopBeep();
+
+	if (Function != FUNCTION_POWER_SAVE) {
+		SYSTEM_SetClockShift(0);
+	}
+
 	PreviousFunction = gCurrentFunction;
 	bWasPowerSave = (PreviousFunction == FUNCTION_POWER_SAVE);
 	gCurrentFunction = Function;
 
+	if (PreviousFunction == FUNCTION_TRANSMIT && Function != FUNCTION_TRANSMIT) {
+		DTMF_CancelTransmit();
+	}
+
 	if (bWasPowerSave) {
 		if (Function != FUNCTION_POWER_SAVE) {
+			BOARD_ADC_Start();
 			BK4819_Conditional_RX_TurnOn_and_GPIO6_Enable();
 			gThisCanEnable_BK4819_Rxon = false;
 			UI_DisplayStatus();
@@ -110,6 +123,9 @@ void FUNCTION_Select(FUNCTION_Type_t Function)
 	}
 
 	if (Function == FUNCTION_MONITOR || Function == FUNCTION_3 || Function == FUNCTION_RECEIVE) {
+		if (Function != FUNCTION_MONITOR) {
+			gBatterySaveIdleCycles = 0;
+		}
 		gBatterySaveCountdown = 1000;
 		gSchedulePowerSave = false;
 		g_2000038E = 0;
@@ -117,11 +133,15 @@ void FUNCTION_Select(FUNCTION_Type_t Function)
 	}
 
 	if (Function == FUNCTION_POWER_SAVE) {
-		gBatterySave = gEeprom.BATTERY_SAVE * 10;
+		gBatterySave = BATTERY_GetSaveDuration();
 		gThisCanEnable_BK4819_Rxon = true;
 		BK4819_DisableVox();
 		BK4819_Sleep();
 		BK4819_ToggleGpioOut(BK4819_GPIO6_PIN2, false);
+		// No free running conversions while asleep, the 500 ms slice
+		// converts once per battery sample instead.
+		BOARD_ADC_Stop();
+		SYSTEM_SetClockShift(SYSTEM_CLOCK_SHIFT_STANDBY);
 		gBatterySaveCountdownExpired = false;
 		gUpdateStatus = true;
 		GUI_SelectNextDisplay(DISPLAY_MAIN);
@@ -154,13 +174,19 @@ void FUNCTION_Select(FUNCTION_Type_t Function)
 		return;
 	}
 
-	GUI_DisplayScreen();
+	RADIO_MarkTxPhase(TX_PHASE_FUNCTION);
 	RADIO_PrepareTransmit();
+	GUI_DisplayScreen();
+	RADIO_MarkTxPhase(TX_PHASE_DISPLAY);
 	BK4819_ToggleGpioOut(BK4819_GPIO1_PIN29, true);
 
 	DTMF_Reply();
+	if (gDTMF_TxState == DTMF_TX_IDLE) {
+		RADIO_MarkTxPhase(TX_PHASE_AUDIO);
+	}
 
 	if (g_20000383) {
+		DTMF_WaitForTransmit();
 		if (g_20000383 == 3) {
 			BK4819_TransmitTone(true, 1750);
 		} else {
@@ -176,7 +202,10 @@ void FUNCTION_Select(FUNCTION_Type_t Function)
 		return;
 	}
 	if (gCrossTxRadioInfo->SCRAMBLING_TYPE && gSetting_ScrambleEnable) {
-		BK4819_EnableScramble(gCrossTxRadioInfo->SCRAMBLING_TYPE - 1U);
+		// Enabled by DTMF_TimeSlice10ms once a BOT code has been sent.
+		if (gDTMF_TxState == DTMF_TX_IDLE) {
+			BK4819_EnableScramble(gCrossTxRadioInfo->SCRAMBLING_TYPE - 1U);
+		}
 		gBatterySaveCountdown = 1000;
 		gSchedulePowerSave = false;
 		g_2000038E = 0;
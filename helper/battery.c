@@ -17,6 +17,7 @@
 #include "battery.h"
 #include "driver/backlight.h"
 #include "misc.h"
+#include "settings.h"
 #include "ui/battery.h"
 #include "ui/menu.h"
 #include "ui/ui.h"
@@ -24,7 +25,7 @@
 uint16_t gBatteryCalibration[6];
 uint16_t gBatteryCurrentVoltage;
 uint16_t gBatteryCurrent;
-uint16_t gBatteryVoltages[4];
+uint16_t gBatteryVoltageEma;
 uint16_t gBatteryVoltageAverage;
 
 uint8_t gBatteryDisplayLevel;
@@ -34,6 +35,84 @@ bool gLowBattery;
 bool gLowBatteryBlink;
 
 volatile uint16_t gBatterySave;
+uint8_t gBatteryTxRecoveryCountdown;
+uint8_t gBatterySaveIdleCycles;
+
+#if !defined(BATTERY_SAVE_PREAMBLE)
+#define BATTERY_SAVE_PREAMBLE 600
+#endif
+
+// The ring holds the last 80 ms of 10 ms samples. Its mean is folded into
+// the average every 500 ms, so 1/8 gives a time constant of about 4 s.
+// The average is kept with 3 extra bits of precision.
+#define BATTERY_RING_SIZE 8U
+#define BATTERY_EMA_SHIFT 3
+
+static uint16_t gBatteryRing[BATTERY_RING_SIZE];
+static uint8_t gBatteryRingIndex;
+static uint8_t gBatteryRingCount;
+
+void BATTERY_AddSample(uint16_t Voltage)
+{
+	gBatteryRing[gBatteryRingIndex] = Voltage;
+	gBatteryRingIndex = (gBatteryRingIndex + 1U) % BATTERY_RING_SIZE;
+	if (gBatteryRingCount < BATTERY_RING_SIZE) {
+		gBatteryRingCount++;
+	}
+}
+
+void BATTERY_UpdateAverage(void)
+{
+	uint32_t Sum;
+	uint16_t Voltage;
+	uint8_t i;
+
+	if (gBatteryRingCount == 0) {
+		return;
+	}
+
+	Sum = 0;
+	for (i = 0; i < gBatteryRingCount; i++) {
+		Sum += gBatteryRing[(gBatteryRingIndex + BATTERY_RING_SIZE - 1U - i) % BATTERY_RING_SIZE];
+	}
+	Voltage = Sum / gBatteryRingCount;
+	gBatteryRingCount = 0;
+
+	if (gBatteryVoltageEma == 0) {
+		gBatteryVoltageEma = Voltage << BATTERY_EMA_SHIFT;
+	} else {
+		gBatteryVoltageEma = gBatteryVoltageEma + Voltage - (gBatteryVoltageEma >> BATTERY_EMA_SHIFT);
+	}
+}
+
+uint16_t BATTERY_GetSaveDuration(void)
+{
+	// RX is on for 100 ms per cycle, so a carrier that lasts the whole
+	// preamble always overlaps one of the RX windows.
+	const uint16_t Limit = (BATTERY_SAVE_PREAMBLE - 100) / 10;
+	uint16_t Duration;
+
+	// Replies tend to come soon after a call, so the first 64 cycles after
+	// the squelch closes sleep half as long. Sleeping past the configured
+	// ratio on a quiet channel would miss more short calls, so it never
+	// does.
+	Duration = gEeprom.BATTERY_SAVE * 10;
+	if (gBatterySaveIdleCycles < 64) {
+		Duration /= 2;
+	}
+	if (gBatterySaveIdleCycles < 255) {
+		gBatterySaveIdleCycles++;
+	}
+
+	if (Duration > Limit) {
+		Duration = Limit;
+	}
+	if (Duration < 10) {
+		Duration = 10;
+	}
+
+	return Duration;
+}
 
 void BATTERY_GetReadings(bool bDisplayBatteryLevel)
 {
@@ -42,7 +121,7 @@ void BATTERY_GetReadings(bool bDisplayBatteryLevel)
 
 	PreviousBatteryLevel = gBatteryDisplayLevel;
 
-	Voltage = (gBatteryVoltages[0] + gBatteryVoltages[1] + gBatteryVoltages[2] + gBatteryVoltages[3]) / 4;
+	Voltage = gBatteryVoltageEma >> BATTERY_EMA_SHIFT;
 
 	if (gBatteryCalibration[5] < Voltage) {
 		gBatteryDisplayLevel = 6;
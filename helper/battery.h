@@ -23,7 +23,7 @@
 extern uint16_t gBatteryCalibration[6];
 extern uint16_t gBatteryCurrentVoltage;
 extern uint16_t gBatteryCurrent;
-extern uint16_t gBatteryVoltages[4];
+extern uint16_t gBatteryVoltageEma;
 extern uint16_t gBatteryVoltageAverage;
 
 extern uint8_t gBatteryDisplayLevel;
@@ -33,7 +33,12 @@ extern bool gLowBattery;
 extern bool gLowBatteryBlink;
 
 extern volatile uint16_t gBatterySave;
+extern uint8_t gBatteryTxRecoveryCountdown;
+extern uint8_t gBatterySaveIdleCycles;
 
+void BATTERY_AddSample(uint16_t Voltage);
+void BATTERY_UpdateAverage(void);
+uint16_t BATTERY_GetSaveDuration(void);
 void BATTERY_GetReadings(bool bDisplayBatteryLevel);
 
 #endif
@@ -0,0 +1,84 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#include "app/fm.h"
+#include "bsp/dp32g030/gpio.h"
+#include "driver/gpio.h"
+#include "functions.h"
+#include "helper/energy.h"
+#include "radio.h"
+
+uint32_t gEnergyTicks[ENERGY_COUNT];
+
+uint16_t gEnergyModel[ENERGY_COUNT] = {
+	300,
+	600,
+	600,
+	900,
+	100,
+	6000,
+	10000,
+	14000,
+	200,
+	250,
+};
+
+void ENERGY_TimeSlice10ms(void)
+{
+	switch (gCurrentFunction) {
+	case FUNCTION_0:
+		gEnergyTicks[ENERGY_IDLE]++;
+		break;
+	case FUNCTION_TRANSMIT:
+		gEnergyTicks[ENERGY_TX_LOW + gCrossTxRadioInfo->OUTPUT_POWER]++;
+		break;
+	case FUNCTION_MONITOR:
+		gEnergyTicks[ENERGY_MONITOR]++;
+		break;
+	case FUNCTION_3:
+		gEnergyTicks[ENERGY_INCOMING]++;
+		break;
+	case FUNCTION_RECEIVE:
+		gEnergyTicks[ENERGY_RECEIVE]++;
+		break;
+	case FUNCTION_POWER_SAVE:
+		gEnergyTicks[ENERGY_POWER_SAVE]++;
+		break;
+	}
+	if (GPIO_CheckBit(&GPIOB->DATA, GPIOB_PIN_BACKLIGHT)) {
+		gEnergyTicks[ENERGY_BACKLIGHT]++;
+	}
+	if (gFmRadioMode) {
+		gEnergyTicks[ENERGY_FM]++;
+	}
+}
+
+uint32_t ENERGY_GetConsumption(void)
+{
+	uint32_t Consumption = 0;
+	uint32_t Remainder = 0;
+	uint8_t i;
+
+	// Ticks of 10 ms times 0.1 mA, divided by 3600, gives uAh. Whole
+	// multiples of 3600 ticks are scaled on their own so the product
+	// cannot wrap, and the rest is summed and divided once at the end.
+	for (i = 0; i < ENERGY_COUNT; i++) {
+		Consumption += (gEnergyTicks[i] / 3600U) * gEnergyModel[i];
+		Remainder += (gEnergyTicks[i] % 3600U) * gEnergyModel[i];
+	}
+
+	return Consumption + (Remainder / 3600U);
+}
@@ -0,0 +1,48 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#ifndef ENERGY_H
+#define ENERGY_H
+
+#include <stdint.h>
+
+enum ENERGY_Source_t {
+	ENERGY_IDLE = 0U,
+	ENERGY_MONITOR,
+	ENERGY_INCOMING,
+	ENERGY_RECEIVE,
+	ENERGY_POWER_SAVE,
+	ENERGY_TX_LOW,
+	ENERGY_TX_MID,
+	ENERGY_TX_HIGH,
+	ENERGY_BACKLIGHT,
+	ENERGY_FM,
+	ENERGY_COUNT,
+};
+
+typedef enum ENERGY_Source_t ENERGY_Source_t;
+
+// Time spent in each state in 10 ms ticks. Backlight and FM are counted
+// on top of the radio state.
+extern uint32_t gEnergyTicks[ENERGY_COUNT];
+// Current drawn in each state in 0.1 mA
+extern uint16_t gEnergyModel[ENERGY_COUNT];
+
+void ENERGY_TimeSlice10ms(void);
+uint32_t ENERGY_GetConsumption(void);
+
+#endif
+
@@ -0,0 +1,38 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#include "helper/stack.h"
+
+extern uint32_t __bss_end__[];
+
+uint16_t STACK_GetSize(void)
+{
+	return STACK_TOP - (uint32_t)__bss_end__;
+}
+
+uint16_t STACK_GetHighWaterMark(void)
+{
+	const uint32_t *pStack;
+
+	for (pStack = __bss_end__; pStack < (const uint32_t *)STACK_TOP; pStack++) {
+		if (*pStack != STACK_PAINT) {
+			break;
+		}
+	}
+
+	return STACK_TOP - (uint32_t)pStack;
+}
+
@@ -0,0 +1,30 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#ifndef STACK_H
+#define STACK_H
+
+#include <stdint.h>
+
+// Both must match HandlerReset in start.S
+#define STACK_TOP   0x20003FF0U
+#define STACK_PAINT 0xCDCDCDCDU
+
+uint16_t STACK_GetSize(void);
+uint16_t STACK_GetHighWaterMark(void);
+
+#endif
+
@@ -56,8 +56,6 @@ void _putchar(char c)
 
 void Main(void)
 {
-	uint8_t i;
-
 	// Enable clock gating of blocks we need.
 	SYSCON_DEV_CLK_GATE = 0
 		| SYSCON_DEV_CLK_GATE_GPIOA_BITS_ENABLE
@@ -92,9 +90,9 @@ void Main(void)
 	RADIO_ConfigureTX();
 	RADIO_SetupRegisters(true);
 
-	for (i = 0; i < 4; i++) {
-		BOARD_ADC_GetBatteryInfo(&gBatteryVoltages[i], &gBatteryCurrent);
-	}
+	BOARD_ADC_GetBatteryInfo(&gBatteryCurrentVoltage, &gBatteryCurrent);
+	BATTERY_AddSample(gBatteryCurrentVoltage);
+	BATTERY_UpdateAverage();
 
 	BATTERY_GetReadings(false);
 	if (!gChargingWithTypeC && !gBatteryDisplayLevel) {
@@ -134,6 +132,7 @@ void Main(void)
 	}
 
 	while (1) {
+		AUDIO_ShiftVoiceID();
 		APP_Update();
 		if (gNextTimeslice) {
 			APP_TimeSlice10ms();
@@ -17,16 +17,12 @@
 #include <string.h>
 #include "misc.h"
 
+MISC_Flags_t gFlags;
+
 const uint32_t *gUpperLimitFrequencyBandTable;
 const uint32_t *gLowerLimitFrequencyBandTable;
 
-bool gSetting_350TX;
-bool gSetting_KILLED;
-bool gSetting_200TX;
-bool gSetting_500TX;
-bool gSetting_350EN;
 uint8_t gSetting_F_LOCK;
-bool gSetting_ScrambleEnable;
 uint8_t gSetting_F_LOCK;
 
 const uint32_t gDefaultAesKey[4] = {
@@ -59,7 +55,6 @@ volatile uint16_t gDualWatchCountdown;
 volatile uint16_t gTxTimerCountdown = 1000;
 volatile uint16_t g_20000342;
 volatile uint16_t gNOAA_Countdown;
-bool gEnableSpeaker;
 uint8_t gKeyLockCountdown;
 uint8_t gRTTECountdown;
 bool bIsInLockScreen;
@@ -72,39 +67,22 @@ uint8_t gFoundCDCSS;
 uint8_t g_20000377;
 uint8_t gVFO_RSSI_Level[2];
 uint8_t gReducedService;
-uint8_t gBatteryVoltageIndex;
 volatile uint8_t g_20000381;
 uint8_t g_20000382;
 uint8_t g_20000383;
 uint16_t g_2000038E;
 uint8_t g_20000393;
-bool g_20000394;
 uint8_t g_20000395;
 uint8_t gKeypadLocked;
 uint8_t g_20000395;
 uint8_t g_20000398;
 uint8_t gVfoConfigureMode;
 uint8_t g_2000039B;
-bool gRequestSaveVFO;
 uint8_t gRequestSaveChannel;
-bool gRequestSaveSettings;
-bool gRequestSaveFM;
 uint8_t g_200003A0;
-bool gFlagStartScan;
-bool gFlagStopScan;
-bool gFlagAcceptSetting;
-bool gFlagRefreshSetting;
-bool gFlagSaveVfo;
-bool gFlagSaveSettings;
 uint8_t gFlagSaveChannel;
-bool gFlagSaveFM;
 uint8_t gDTMF_RequestPending;
-bool g_CDCSS_Lost;
 uint8_t gCDCSSCodeType;
-bool g_CTCSS_Lost;
-bool g_CxCSS_TAIL_Found;
-bool g_VOX_Lost;
-bool g_SquelchLost;
 uint8_t gFlashLightState;
 uint8_t g_200003B4;
 uint16_t g_200003B6;
@@ -127,10 +105,7 @@ uint8_t g_2000041F;
 uint8_t g_20000420;
 uint16_t g_20000422;
 uint8_t g_20000427;
-bool gKeyBeingHeld;
-bool gPttIsPressed;
 uint8_t gPttDebounceCounter;
-bool g_20000439;
 uint8_t gMenuListCount;
 uint8_t g_20000458;
 uint8_t gBackupCROSS_BAND_RX_TX;
@@ -143,11 +118,8 @@ uint8_t gAircopySendCountdown;
 uint8_t gFSKWriteIndex;
 uint8_t g_20000474;
 
-bool gIsNoaaMode;
 volatile bool gNextTimeslice;
 uint8_t gNoaaChannel;
-bool gUpdateDisplay;
-bool gF_LOCK;
 uint8_t gScanChannel;
 uint32_t gScanFrequency;
 uint8_t gScanPauseMode;
@@ -172,8 +144,18 @@ volatile uint16_t ScanPauseDelayIn10msec;
 uint16_t gCurrentRSSI;
 
 volatile int8_t gStepDirection;
+uint8_t gScanRssiCountdown;
+uint32_t gScanStepCount;
+uint32_t gScanSkipCount;
+uint32_t gScanTickCount;
+
+uint8_t gPriorityWatchCountdown;
+uint8_t gPriorityWatchChannel[2];
+uint32_t gPriorityWatchFrequency[2];
+uint32_t gPriorityWatchLast;
+uint32_t gPriorityRevisitTime;
+uint32_t gPriorityRevisitMax;
 
-bool gIsLocked;
 
 // --------
 
@@ -47,16 +47,80 @@ enum {
 	VFO_CONFIGURE_RELOAD = 2U,
 };
 
+// Flags only ever written from the main loop, packed one bit each.
+// Anything the SysTick handler writes stays a volatile byte of its own.
+typedef struct {
+	bool Setting_350TX:1;
+	bool Setting_KILLED:1;
+	bool Setting_200TX:1;
+	bool Setting_500TX:1;
+	bool Setting_350EN:1;
+	bool Setting_ScrambleEnable:1;
+	bool EnableSpeaker:1;
+	bool b20000394:1;
+	bool RequestSaveVFO:1;
+	bool RequestSaveSettings:1;
+	bool RequestSaveFM:1;
+	bool FlagStartScan:1;
+	bool FlagStopScan:1;
+	bool FlagAcceptSetting:1;
+	bool FlagRefreshSetting:1;
+	bool FlagSaveVfo:1;
+	bool FlagSaveSettings:1;
+	bool FlagSaveFM:1;
+	bool CDCSS_Lost:1;
+	bool CTCSS_Lost:1;
+	bool CxCSS_TAIL_Found:1;
+	bool VOX_Lost:1;
+	bool SquelchLost:1;
+	bool KeyBeingHeld:1;
+	bool PttIsPressed:1;
+	bool b20000439:1;
+	bool IsNoaaMode:1;
+	bool UpdateDisplay:1;
+	bool F_LOCK:1;
+	bool PriorityWatch:1;
+	bool IsLocked:1;
+} MISC_Flags_t;
+
+#define gSetting_350TX          gFlags.Setting_350TX
+#define gSetting_KILLED         gFlags.Setting_KILLED
+#define gSetting_200TX          gFlags.Setting_200TX
+#define gSetting_500TX          gFlags.Setting_500TX
+#define gSetting_350EN          gFlags.Setting_350EN
+#define gSetting_ScrambleEnable gFlags.Setting_ScrambleEnable
+#define gEnableSpeaker          gFlags.EnableSpeaker
+#define g_20000394              gFlags.b20000394
+#define gRequestSaveVFO         gFlags.RequestSaveVFO
+#define gRequestSaveSettings    gFlags.RequestSaveSettings
+#define gRequestSaveFM          gFlags.RequestSaveFM
+#define gFlagStartScan          gFlags.FlagStartScan
+#define gFlagStopScan           gFlags.FlagStopScan
+#define gFlagAcceptSetting      gFlags.FlagAcceptSetting
+#define gFlagRefreshSetting     gFlags.FlagRefreshSetting
+#define gFlagSaveVfo            gFlags.FlagSaveVfo
+#define gFlagSaveSettings       gFlags.FlagSaveSettings
+#define gFlagSaveFM             gFlags.FlagSaveFM
+#define g_CDCSS_Lost            gFlags.CDCSS_Lost
+#define g_CTCSS_Lost            gFlags.CTCSS_Lost
+#define g_CxCSS_TAIL_Found      gFlags.CxCSS_TAIL_Found
+#define g_VOX_Lost              gFlags.VOX_Lost
+#define g_SquelchLost           gFlags.SquelchLost
+#define gKeyBeingHeld           gFlags.KeyBeingHeld
+#define gPttIsPressed           gFlags.PttIsPressed
+#define g_20000439              gFlags.b20000439
+#define gIsNoaaMode             gFlags.IsNoaaMode
+#define gUpdateDisplay          gFlags.UpdateDisplay
+#define gF_LOCK                 gFlags.F_LOCK
+#define gPriorityWatch          gFlags.PriorityWatch
+#define gIsLocked               gFlags.IsLocked
+
+extern MISC_Flags_t gFlags;
+
 extern const uint32_t *gUpperLimitFrequencyBandTable;
 extern const uint32_t *gLowerLimitFrequencyBandTable;
 
-extern bool gSetting_350TX;
-extern bool gSetting_KILLED;
-extern bool gSetting_200TX;
-extern bool gSetting_500TX;
-extern bool gSetting_350EN;
 extern uint8_t gSetting_F_LOCK;
-extern bool gSetting_ScrambleEnable;
 extern uint8_t gSetting_F_LOCK;
 
 extern const uint32_t gDefaultAesKey[4];
@@ -84,7 +148,6 @@ extern volatile uint16_t gTxTimerCountdown;
 extern volatile uint16_t g_20000342;
 extern volatile uint16_t gFmPlayCountdown;
 extern volatile uint16_t gNOAA_Countdown;
-extern bool gEnableSpeaker;
 extern uint8_t gKeyLockCountdown;
 extern uint8_t gRTTECountdown;
 extern bool bIsInLockScreen;
@@ -97,39 +160,22 @@ extern uint8_t gFoundCDCSS;
 extern uint8_t g_20000377;
 extern uint8_t gVFO_RSSI_Level[2];
 extern uint8_t gReducedService;
-extern uint8_t gBatteryVoltageIndex;
 extern volatile uint8_t g_20000381;
 extern uint8_t g_20000382;
 extern uint8_t g_20000383;
 extern uint16_t g_2000038E;
 extern volatile int8_t gFM_Step;
 extern uint8_t g_20000393;
-extern bool g_20000394;
 extern uint8_t g_20000395;
 extern uint8_t g_20000398;
 extern uint8_t gVfoConfigureMode;
 extern uint8_t g_2000039B;
-extern bool gRequestSaveVFO;
 extern uint8_t gRequestSaveChannel;
-extern bool gRequestSaveSettings;
-extern bool gRequestSaveFM;
 extern uint8_t gKeypadLocked;
 extern uint8_t g_200003A0;
-extern bool gFlagStartScan;
-extern bool gFlagStopScan;
-extern bool gFlagAcceptSetting;
-extern bool gFlagRefreshSetting;
-extern bool gFlagSaveVfo;
-extern bool gFlagSaveSettings;
 extern uint8_t gFlagSaveChannel;
-extern bool gFlagSaveFM;
 extern uint8_t gDTMF_RequestPending;
-extern bool g_CDCSS_Lost;
 extern uint8_t gCDCSSCodeType;
-extern bool g_CTCSS_Lost;
-extern bool g_CxCSS_TAIL_Found;
-extern bool g_VOX_Lost;
-extern bool g_SquelchLost;
 extern uint8_t gFlashLightState;
 extern uint8_t g_200003B4;
 extern uint16_t g_200003B6;
@@ -152,10 +198,7 @@ extern uint8_t g_2000041F;
 extern uint8_t g_20000420;
 extern uint16_t g_20000422;
 extern uint8_t g_20000427;
-extern bool gKeyBeingHeld;
-extern bool gPttIsPressed;
 extern uint8_t gPttDebounceCounter;
-extern bool g_20000439;
 extern uint8_t gMenuListCount;
 extern uint8_t g_20000458;
 extern uint8_t gBackupCROSS_BAND_RX_TX;
@@ -169,12 +212,10 @@ extern uint8_t gFSKWriteIndex;
 extern uint8_t g_20000474;
 
 extern bool gFM_AutoScan;
-extern bool gIsNoaaMode;
 extern volatile bool gNextTimeslice;
+extern volatile uint32_t gGlobalSysTickCounter;
 extern uint8_t gNoaaChannel;
-extern bool gUpdateDisplay;
 extern uint8_t gFM_ChannelPosition;
-extern bool gF_LOCK;
 extern uint8_t gScanChannel;
 extern uint32_t gScanFrequency;
 extern uint8_t gScanPauseMode;
@@ -199,8 +240,18 @@ extern volatile uint16_t ScanPauseDelayIn10msec;
 extern uint16_t gCurrentRSSI;
 
 extern volatile int8_t gStepDirection;
+extern uint8_t gScanRssiCountdown;
+extern uint32_t gScanStepCount;
+extern uint32_t gScanSkipCount;
+extern uint32_t gScanTickCount;
+
+extern uint8_t gPriorityWatchCountdown;
+extern uint8_t gPriorityWatchChannel[2];
+extern uint32_t gPriorityWatchFrequency[2];
+extern uint32_t gPriorityWatchLast;
+extern uint32_t gPriorityRevisitTime;
+extern uint32_t gPriorityRevisitMax;
 
-extern bool gIsLocked;
 
 // --------
 
@@ -23,6 +23,7 @@
 #include "driver/bk4819.h"
 #include "driver/eeprom.h"
 #include "driver/gpio.h"
+#include "driver/systick.h"
 #include "driver/system.h"
 #include "frequencies.h"
 #include "functions.h"
@@ -41,6 +42,10 @@ uint8_t gCode;
 
 STEP_Setting_t gStepSetting;
 
+uint32_t gTxPhaseTime[TX_PHASE_COUNT];
+
+uint32_t gMR_ChannelBitmap[3][MR_CH_BITMAP_WORDS];
+
 bool RADIO_CheckValidChannel(uint16_t Channel, bool bCheckScanList, uint8_t VFO)
 {
 	uint8_t Attributes;
@@ -87,17 +92,95 @@ bool RADIO_CheckValidChannel(uint16_t Channel, bool bCheckScanList, uint8_t VFO)
 	return true;
 }
 
+void RADIO_UpdateChannelBitmap(uint8_t Channel)
+{
+	const uint32_t Bit = 1U << (Channel & 31U);
+	const uint8_t Word = Channel >> 5;
+	uint8_t Attributes;
+
+	if (!IS_MR_CHANNEL(Channel)) {
+		return;
+	}
+	Attributes = gMR_ChannelAttributes[Channel];
+	gMR_ChannelBitmap[MR_CH_LIST_1][Word] &= ~Bit;
+	gMR_ChannelBitmap[MR_CH_LIST_2][Word] &= ~Bit;
+	gMR_ChannelBitmap[MR_CH_LIST_ALL][Word] &= ~Bit;
+	if ((Attributes & MR_CH_BAND_MASK) > BAND7_470MHz) {
+		return;
+	}
+	gMR_ChannelBitmap[MR_CH_LIST_ALL][Word] |= Bit;
+	if (Attributes & MR_CH_SCANLIST1) {
+		gMR_ChannelBitmap[MR_CH_LIST_1][Word] |= Bit;
+	}
+	if (Attributes & MR_CH_SCANLIST2) {
+		gMR_ChannelBitmap[MR_CH_LIST_2][Word] |= Bit;
+	}
+}
+
+static uint8_t RADIO_FindChannelInBitmap(const uint32_t *pBitmap, uint8_t Channel, int8_t Direction)
+{
+	uint32_t Bits;
+	uint8_t Word;
+	uint8_t Pass;
+
+	for (Pass = 0; Pass < 2; Pass++) {
+		Word = Channel >> 5;
+		if (Direction > 0) {
+			Bits = pBitmap[Word] & (0xFFFFFFFFU << (Channel & 31U));
+			while (!Bits && Word < MR_CH_BITMAP_WORDS - 1) {
+				Bits = pBitmap[++Word];
+			}
+			if (Bits) {
+				Channel = Word * 32U;
+				while ((Bits & 1U) == 0) {
+					Bits >>= 1;
+					Channel++;
+				}
+				return Channel;
+			}
+			Channel = MR_CHANNEL_FIRST;
+		} else {
+			Bits = pBitmap[Word] & (0xFFFFFFFFU >> (31U - (Channel & 31U)));
+			while (!Bits && Word > 0) {
+				Bits = pBitmap[--Word];
+			}
+			if (Bits) {
+				Channel = (Word * 32U) + 31U;
+				while ((Bits & 0x80000000U) == 0) {
+					Bits <<= 1;
+					Channel--;
+				}
+				return Channel;
+			}
+			Channel = MR_CHANNEL_LAST;
+		}
+	}
+
+	return 0xFF;
+}
+
 uint8_t RADIO_FindNextChannel(uint8_t Channel, int8_t Direction, bool bCheckScanList, uint8_t VFO)
 {
+	uint8_t List;
 	uint8_t i;
 
-	for (i = 0; i < 200; i++) {
+	List = MR_CH_LIST_ALL;
+	if (bCheckScanList && VFO < MR_CH_LIST_ALL) {
+		List = VFO;
+	}
+
+	// Scan lists skip their priority channels, so at most two hits are rejected.
+	for (i = 0; i < 3; i++) {
 		if (Channel == 0xFF) {
 			Channel = MR_CHANNEL_LAST;
 		} else if (Channel > MR_CHANNEL_LAST) {
 			Channel = MR_CHANNEL_FIRST;
 		}
-		if (RADIO_CheckValidChannel(Channel, bCheckScanList, VFO)) {
+		Channel = RADIO_FindChannelInBitmap(gMR_ChannelBitmap[List], Channel, Direction);
+		if (Channel == 0xFF || List == MR_CH_LIST_ALL) {
+			return Channel;
+		}
+		if (Channel != gEeprom.SCANLIST_PRIORITY_CH1[List] && Channel != gEeprom.SCANLIST_PRIORITY_CH2[List]) {
 			return Channel;
 		}
 		Channel += Direction;
@@ -490,6 +573,8 @@ void RADIO_SetupRegisters(bool bSwitchToFunction0)
 	BK4819_SetupPowerAmplifier(0, 0);
 	BK4819_ToggleGpioOut(BK4819_GPIO5_PIN1, false);
 
+	// Mask sources first so the drain below normally completes in one pass.
+	BK4819_WriteRegister(BK4819_REG_3F, 0);
 	while (1) {
 		Status = BK4819_GetRegister(BK4819_REG_0C);
 		if ((Status & 1U) == 0) { // INTERRUPT REQUEST
@@ -498,7 +583,6 @@ void RADIO_SetupRegisters(bool bSwitchToFunction0)
 		BK4819_WriteRegister(BK4819_REG_02, 0);
 		SYSTEM_DelayMs(1);
 	}
-	BK4819_WriteRegister(BK4819_REG_3F, 0);
 	BK4819_WriteRegister(BK4819_REG_7D, gEeprom.MIC_SENSITIVITY_TUNING | 0xE940);
 	if (IS_NOT_NOAA_CHANNEL(gRxInfo->CHANNEL_SAVE) || !gIsNoaaMode) {
 		Frequency = gRxInfo->pCurrent->Frequency;
@@ -641,6 +725,7 @@ void RADIO_ConfigureNOAA(void)
 void RADIO_PrepareTransmit(void)
 {
 	BK4819_FilterBandwidth_t Bandwidth;
+	uint32_t Deadline;
 
 	GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_AUDIO_PATH);
 
@@ -654,15 +739,9 @@ void RADIO_PrepareTransmit(void)
 	BK4819_SetFilterBandwidth(Bandwidth);
 	BK4819_SetFrequency(gCrossTxRadioInfo->pReverse->Frequency);
 	BK4819_PrepareTransmit();
-	SYSTEM_DelayMs(10);
-
-	BK4819_PickRXFilterPathBasedOnFrequency(gCrossTxRadioInfo->pReverse->Frequency);
-	BK4819_ToggleGpioOut(BK4819_GPIO5_PIN1, true);
-	SYSTEM_DelayMs(5);
-
-	BK4819_SetupPowerAmplifier(gCrossTxRadioInfo->TXP_CalculatedSetting, gCrossTxRadioInfo->pReverse->Frequency);
-	SYSTEM_DelayMs(10);
+	Deadline = SYSTICK_GetMicroseconds() + 10000;
 
+	// Sub-audio does not depend on the synthesizer, so set it up while it locks.
 	switch (gCrossTxRadioInfo->pReverse->CodeType) {
 	case CODE_TYPE_CONTINUOUS_TONE:
 		BK4819_SetCTCSSFrequency(CTCSS_Options[gCrossTxRadioInfo->pReverse->Code]);
@@ -680,6 +759,23 @@ void RADIO_PrepareTransmit(void)
 		BK4819_ExitSubAu();
 		break;
 	}
+	SYSTICK_WaitUntil(Deadline);
+
+	BK4819_PickRXFilterPathBasedOnFrequency(gCrossTxRadioInfo->pReverse->Frequency);
+	BK4819_ToggleGpioOut(BK4819_GPIO5_PIN1, true);
+	SYSTICK_WaitUntil(SYSTICK_GetMicroseconds() + 5000);
+
+	// The PA ramps up while the caller updates the display.
+	BK4819_SetupPowerAmplifier(gCrossTxRadioInfo->TXP_CalculatedSetting, gCrossTxRadioInfo->pReverse->Frequency);
+	RADIO_MarkTxPhase(TX_PHASE_PA_ON);
+}
+
+void RADIO_MarkTxPhase(RADIO_TxPhase_t Phase)
+{
+	if (Phase == TX_PHASE_PTT_DOWN) {
+		memset(gTxPhaseTime, 0, sizeof(gTxPhaseTime));
+	}
+	gTxPhaseTime[Phase] = SYSTICK_GetMicroseconds();
 }
 
 void RADIO_SomethingElse(uint8_t Arg)
@@ -775,16 +871,12 @@ void RADIO_EnableCxCSS(void)
 		BK4819_EnableCTCSS();
 		break;
 	}
-
-	SYSTEM_DelayMs(200);
 }
 
 void RADIO_Something(void)
 {
 	RADIO_SomethingWithTransmit();
-	SYSTEM_DelayMs(200);
-	RADIO_EnableCxCSS();
-	RADIO_SetupRegisters(true);
+	DTMF_SetTransmitEnd(DTMF_TX_END_RX);
 }
 
 void RADIO_Whatever(void)
@@ -793,31 +885,26 @@ void RADIO_Whatever(void)
 	RADIO_SetupRegisters(true);
 }
 
-void RADIO_SendEndOfTransmission(void)
+void RADIO_SendEndOfTransmission(DTMF_TxEnd_t End)
 {
+	const char *pString;
+	uint16_t Delay;
+
 	if (gEeprom.ROGER == ROGER_MODE_ROGER) {
 		BK4819_PlayRoger();
 	} else if (gEeprom.ROGER == ROGER_MODE_MDC) {
 		BK4819_PlayRogerMDC();
 	}
+	pString = NULL;
+	Delay = 0;
 	if (gDTMF_CallState == DTMF_CALL_STATE_NONE && (gCrossTxRadioInfo->DTMF_PTT_ID_TX_MODE == PTT_ID_EOT || gCrossTxRadioInfo->DTMF_PTT_ID_TX_MODE == PTT_ID_BOTH)) {
 		if (gEeprom.DTMF_SIDE_TONE) {
 			GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_AUDIO_PATH);
 			gEnableSpeaker = true;
-			SYSTEM_DelayMs(60);
-		}
-		BK4819_EnterDTMF_TX(gEeprom.DTMF_SIDE_TONE);
-		BK4819_PlayDTMFString(
-			gEeprom.DTMF_DOWN_CODE,
-			0,
-			gEeprom.DTMF_FIRST_CODE_PERSIST_TIME,
-			gEeprom.DTMF_HASH_CODE_PERSIST_TIME,
-			gEeprom.DTMF_CODE_PERSIST_TIME,
-			gEeprom.DTMF_CODE_INTERVAL_TIME
-			);
-		GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_AUDIO_PATH);
-		gEnableSpeaker = false;
+			Delay = 60;
+		}
+		pString = gEeprom.DTMF_DOWN_CODE;
 	}
-	BK4819_ExitDTMF_TX(true);
+	DTMF_Transmit(pString, false, Delay, End);
 }
 
@@ -19,6 +19,7 @@
 
 #include <stdbool.h>
 #include <stdint.h>
+#include "app/dtmf.h"
 #include "dcs.h"
 
 enum {
@@ -27,6 +28,13 @@ enum {
 	MR_CH_BAND_MASK = 0x0FU,
 };
 
+enum {
+	MR_CH_LIST_1 = 0U,
+	MR_CH_LIST_2 = 1U,
+	MR_CH_LIST_ALL = 2U,
+	MR_CH_BITMAP_WORDS = 7U,
+};
+
 enum {
 	RADIO_CHANNEL_UP = 0x01U,
 	RADIO_CHANNEL_DOWN = 0xFFU,
@@ -46,6 +54,18 @@ enum PTT_ID_t {
 
 typedef enum PTT_ID_t PTT_ID_t;
 
+enum RADIO_TxPhase_t {
+	TX_PHASE_PTT_DOWN = 0U,
+	TX_PHASE_PTT_ACCEPTED,
+	TX_PHASE_FUNCTION,
+	TX_PHASE_PA_ON,
+	TX_PHASE_DISPLAY,
+	TX_PHASE_AUDIO,
+	TX_PHASE_COUNT,
+};
+
+typedef enum RADIO_TxPhase_t RADIO_TxPhase_t;
+
 enum STEP_Setting_t {
 	STEP_2_5kHz,
 	STEP_5_0kHz,
@@ -107,7 +127,12 @@ extern uint8_t gCode;
 
 extern STEP_Setting_t gStepSetting;
 
+extern uint32_t gTxPhaseTime[TX_PHASE_COUNT];
+
+extern uint32_t gMR_ChannelBitmap[3][MR_CH_BITMAP_WORDS];
+
 bool RADIO_CheckValidChannel(uint16_t ChNum, bool bCheckScanList, uint8_t RadioNum);
+void RADIO_UpdateChannelBitmap(uint8_t Channel);
 uint8_t RADIO_FindNextChannel(uint8_t ChNum, int8_t Direction, bool bCheckScanList, uint8_t RadioNum);
 void RADIO_InitInfo(VFO_Info_t *pInfo, uint8_t ChannelSave, uint8_t ChIndex, uint32_t Frequency);
 void RADIO_ConfigureChannel(uint8_t RadioNum, uint32_t Arg);
@@ -118,13 +143,14 @@ void RADIO_ConfigureCrossTX(void);
 void RADIO_SetupRegisters(bool bSwitchToFunction0);
 void RADIO_ConfigureNOAA(void);
 void RADIO_PrepareTransmit(void);
+void RADIO_MarkTxPhase(RADIO_TxPhase_t Phase);
 
 void RADIO_SomethingElse(uint8_t Arg);
 void RADIO_SomethingWithTransmit(void);
 void RADIO_EnableCxCSS(void);
 void RADIO_Something(void);
 void RADIO_Whatever(void);
-void RADIO_SendEndOfTransmission(void);
+void RADIO_SendEndOfTransmission(DTMF_TxEnd_t End);
 
 #endif
 
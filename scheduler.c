@@ -17,10 +17,11 @@
 #include "audio.h"
 #include "functions.h"
 #include "helper/battery.h"
+#include "helper/energy.h"
 #include "misc.h"
 #include "settings.h"
 
-static volatile uint32_t gGlobalSysTickCounter;
+volatile uint32_t gGlobalSysTickCounter;
 
 void SystickHandler(void);
 
@@ -28,6 +29,7 @@ void SystickHandler(void)
 {
 	gGlobalSysTickCounter++;
 	gNextTimeslice = true;
+	ENERGY_TimeSlice10ms();
 	if ((gGlobalSysTickCounter % 50) == 0) {
 		gNextTimeslice500ms = true;
 		if (gTxTimerCountdown) {
@@ -105,7 +107,7 @@ void SystickHandler(void)
 		}
 	}
 
-	if (gCountdownToPlayNextVoice) {
+	if (gCountdownToPlayNextVoice && !AUDIO_IsVoiceSending()) {
 		gCountdownToPlayNextVoice--;
 		if (gCountdownToPlayNextVoice == 0) {
 			gFlagPlayQueuedVoice = true;
@@ -245,6 +245,7 @@ void SETTINGS_UpdateChannel(uint8_t Channel, const VFO_Info_t *pVFO, bool bUpdat
 		State[Channel & 7U] = Attributes;
 		EEPROM_WriteBuffer(Offset, State);
 		gMR_ChannelAttributes[Channel] = Attributes;
+		RADIO_UpdateChannelBitmap(Channel);
 	}
 }
 
@@ -100,15 +100,13 @@ enum CHANNEL_DisplayMode_t {
 typedef enum CHANNEL_DisplayMode_t CHANNEL_DisplayMode_t;
 
 typedef struct {
+	uint32_t POWER_ON_PASSWORD;
 	uint8_t ScreenChannel[2];
 	uint8_t FreqChannel[2];
 	uint8_t MrChannel[2];
 	uint8_t NoaaChannel[2];
 	uint8_t RX_CHANNEL;
 	uint8_t TX_CHANNEL;
-	uint8_t field7_0xa;
-	uint8_t field8_0xb;
-	uint32_t POWER_ON_PASSWORD;
 	uint8_t SQUELCH_LEVEL;
 	uint8_t TX_TIMEOUT_TIMER;
 	bool KEY_LOCK;
@@ -128,16 +126,12 @@ typedef struct {
 	bool SCAN_LIST_ENABLED[2];
 	uint8_t SCANLIST_PRIORITY_CH1[2];
 	uint8_t SCANLIST_PRIORITY_CH2[2];
-	uint8_t field29_0x26;
-	uint8_t field30_0x27;
 	uint16_t VOX1_THRESHOLD;
 	uint16_t VOX0_THRESHOLD;
 	uint16_t FM_SelectedFrequency;
 	uint8_t FM_SelectedChannel;
 	bool FM_IsMrMode;
 	uint16_t FM_FrequencyPlaying;
-	uint8_t field37_0x32;
-	uint8_t field38_0x33;
 	uint16_t FM_LowerLimit;
 	uint16_t FM_UpperLimit;
 	bool AUTO_KEYPAD_LOCK;
@@ -156,11 +150,10 @@ typedef struct {
 	char KILL_CODE[8];
 	char REVIVE_CODE[8];
 	char DTMF_UP_CODE[16];
-	uint8_t field57_0x6c;
-	uint8_t field58_0x6d;
+	// Keeps a full length code NUL terminated for strcpy/strlen
+	uint8_t DTMF_UP_CODE_NUL[2];
 	char DTMF_DOWN_CODE[16];
-	uint8_t field60_0x7e;
-	uint8_t field61_0x7f;
+	uint8_t DTMF_DOWN_CODE_NUL[2];
 	char DTMF_SEPARATE_CODE;
 	char DTMF_GROUP_CALL_CODE;
 	uint8_t DTMF_DECODE_RESPONSE;
@@ -176,9 +169,6 @@ typedef struct {
 	bool NOAA_AUTO_SCAN;
 	uint8_t VOLUME_GAIN;
 	uint8_t DAC_GAIN;
-	uint8_t field77_0x95;
-	uint8_t field78_0x96;
-	uint8_t field79_0x97;
 	VFO_Info_t VfoInfo[2];
 } EEPROM_Config_t;
 
@@ -0,0 +1,110 @@
+#!/usr/bin/env python3
+# Copyright 2023 Dual Tachyon
+# https://github.com/DualTachyon
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Flash used per subsystem and per symbol, checked against a budget file.
+
+import argparse
+import os
+import subprocess
+import sys
+
+def subsystem(obj):
+	parts = obj.split('/')
+	if len(parts) == 1:
+		return 'core'
+	return parts[0]
+
+def object_sizes(size, objs):
+	sizes = {}
+	out = subprocess.check_output([size, '-B'] + objs, universal_newlines=True)
+	for line in out.splitlines()[1:]:
+		fields = line.split()
+		# .data is stored in flash too
+		sizes[fields[5]] = int(fields[0]) + int(fields[1])
+	return sizes
+
+def image_size(size, elf):
+	out = subprocess.check_output([size, '-B', elf], universal_newlines=True)
+	fields = out.splitlines()[1].split()
+	return int(fields[0]) + int(fields[1])
+
+def symbol_sizes(nm, elf):
+	symbols = []
+	out = subprocess.check_output([nm, '-S', '-t', 'd', '--size-sort', elf], universal_newlines=True)
+	for line in out.splitlines():
+		fields = line.split()
+		if len(fields) == 4 and fields[2] in 'TtRrDd':
+			symbols.append((int(fields[1]), fields[3]))
+	return sorted(symbols, reverse=True)
+
+def load_budget(name):
+	budget = {}
+	if os.path.exists(name):
+		with open(name) as f:
+			for line in f:
+				line = line.split('#')[0].split()
+				if len(line) == 2:
+					budget[line[0]] = int(line[1], 0)
+	return budget
+
+def main():
+	parser = argparse.ArgumentParser()
+	parser.add_argument('--size', default='arm-none-eabi-size')
+	parser.add_argument('--nm', default='arm-none-eabi-nm')
+	parser.add_argument('--budget', required=True)
+	parser.add_argument('--update', action='store_true')
+	parser.add_argument('--headroom', type=int, default=0)
+	parser.add_argument('--top', type=int, default=20)
+	parser.add_argument('elf')
+	parser.add_argument('objs', nargs='*')
+	args = parser.parse_args()
+
+	budget = load_budget(args.budget)
+	total = image_size(args.size, args.elf)
+	used = {}
+	if args.objs:
+		for obj, size in object_sizes(args.size, args.objs).items():
+			used[subsystem(obj)] = used.get(subsystem(obj), 0) + size
+
+	print('%6s  %s' % ('flash', 'symbol'))
+	for size, name in symbol_sizes(args.nm, args.elf)[:args.top]:
+		print('%6d  %s' % (size, name))
+	print()
+
+	failed = False
+	print('%6s  %6s  %s' % ('flash', 'budget', 'subsystem'))
+	for name in sorted(used) + ['total']:
+		size = total if name == 'total' else used[name]
+		limit = budget.get(name)
+		if limit is None:
+			print('%6d  %6s  %s' % (size, '-', name))
+			continue
+		over = size > limit
+		failed |= over
+		print('%6d  %6d  %s%s' % (size, limit, name, ' OVER BUDGET' if over else ''))
+
+	if args.update:
+		with open(args.budget, 'w') as f:
+			f.write('# Flash budget in bytes per subsystem, regenerate with "make flash-budget"\n')
+			for name in sorted(used):
+				f.write('%s %d\n' % (name, (used[name] * (100 + args.headroom) + 99) // 100))
+			f.write('total %d\n' % budget.get('total', total))
+		return 0
+
+	return 1 if failed else 0
+
+if __name__ == '__main__':
+	sys.exit(main())
@@ -0,0 +1,301 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+// Simulates the battery save duty cycle on synthetic channel traffic.
+//
+// Time is counted in 10 ms ticks. After a call, or at start, the radio
+// stays awake for 10 s, then cycles between sleeping for the time returned
+// by BATTERY_GetSaveDuration and a 100 ms RX window. A call is heard when
+// its carrier overlaps RX for at least DETECT_TICKS in a row. The radio
+// then stays awake until the call ends and the cycle starts over.
+//
+// Each trace is run with the adaptive duration and with the old fixed
+// BATTERY_SAVE * 10 ticks, and reports the average current and the share
+// of missed calls by length. It fails when a call of at least
+// BATTERY_SAVE_PREAMBLE is missed, or when the adaptive timing misses
+// more calls than the fixed one in any length range.
+
+#include <stdio.h>
+#include "helper/battery.c"
+
+#define HOURS 200U
+#define TICKS_PER_SECOND 100U
+#define AWAKE_TICKS 1000U
+#define RX_WINDOW_TICKS 10U
+#define DETECT_TICKS 3U
+// Each trace is run with the awake period stretched by a different
+// offset, which moves the sleep cycles across every call. The result is
+// then the chance of missing each call rather than one draw of it.
+#define PHASES 30U
+#define PHASE_STEP_TICKS 2U
+#define MAX_CALLS 200000U
+#define AWAKE_MA 60U
+#define SLEEP_MA 12U
+// Allowed excess of adaptive over fixed misses, in calls per thousand,
+// for what noise is left between two runs on the same trace.
+#define MISS_SLACK 10U
+
+enum {
+	TRACE_QUIET,
+	TRACE_BUSY,
+	TRACE_BURSTY,
+};
+
+enum {
+	LENGTH_SHORT,
+	LENGTH_MEDIUM,
+	LENGTH_LONG,
+	LENGTH_COUNT,
+};
+
+typedef struct {
+	uint32_t Start;
+	uint32_t End;
+	bool bHeard;
+} Call_t;
+
+typedef struct {
+	uint32_t Calls[LENGTH_COUNT];
+	uint32_t Missed[LENGTH_COUNT];
+	double Current;
+} Result_t;
+
+EEPROM_Config_t gEeprom;
+
+static Call_t gCalls[MAX_CALLS];
+static uint32_t gCallCount;
+static uint32_t gNextCall;
+static uint32_t gSeed;
+
+static uint32_t Random(uint32_t Range)
+{
+	gSeed = (gSeed * 1664525U) + 1013904223U;
+	return (uint32_t)(((uint64_t)(gSeed >> 8) * Range) >> 24);
+}
+
+// 30% short bursts of 100 to 600 ms, the rest 1 to 8 s of speech
+static uint32_t CallLength(void)
+{
+	if (Random(10) < 3) {
+		return 10U + Random(51);
+	}
+	return TICKS_PER_SECOND + Random(7U * TICKS_PER_SECOND);
+}
+
+static void AddCall(uint32_t *pTime, uint32_t Gap)
+{
+	const uint32_t Length = CallLength();
+
+	if (gCallCount == MAX_CALLS) {
+		return;
+	}
+	*pTime += Gap;
+	gCalls[gCallCount].Start = *pTime;
+	gCalls[gCallCount].End = *pTime + Length;
+	gCalls[gCallCount].bHeard = false;
+	gCallCount++;
+	*pTime += Length;
+}
+
+static void MakeTrace(uint8_t Trace, uint32_t End)
+{
+	uint32_t Time;
+
+	gSeed = 1U + Trace;
+	gCallCount = 0;
+	Time = 0;
+	while (Time < End) {
+		switch (Trace) {
+		case TRACE_QUIET:
+			// About one call every 30 min
+			AddCall(&Time, 1U + Random(2U * 1800U * TICKS_PER_SECOND));
+			break;
+		case TRACE_BUSY:
+			// About one call a minute
+			AddCall(&Time, 1U + Random(2U * 60U * TICKS_PER_SECOND));
+			break;
+		default:
+			{
+				// A conversation of 3 to 8 calls every 20 min or so,
+				// with replies 15 to 60 s apart
+				uint32_t Count = 3U + Random(6);
+
+				AddCall(&Time, 1U + Random(2U * 1200U * TICKS_PER_SECOND));
+				while (--Count) {
+					AddCall(&Time, (15U * TICKS_PER_SECOND) + Random(45U * TICKS_PER_SECOND));
+				}
+			}
+			break;
+		}
+	}
+}
+
+// Returns true when a call overlaps RX on [From, To) for long enough to
+// open the squelch, with the end of that call in *pEnd.
+static bool Listen(uint32_t From, uint32_t To, uint32_t *pEnd)
+{
+	uint32_t i;
+
+	while (gNextCall < gCallCount && gCalls[gNextCall].End <= From) {
+		gNextCall++;
+	}
+	for (i = gNextCall; i < gCallCount && gCalls[i].Start < To; i++) {
+		const uint32_t Start = gCalls[i].Start > From ? gCalls[i].Start : From;
+		const uint32_t End = gCalls[i].End < To ? gCalls[i].End : To;
+
+		if (End >= Start + DETECT_TICKS) {
+			gCalls[i].bHeard = true;
+			*pEnd = gCalls[i].End;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static uint16_t FixedSaveDuration(void)
+{
+	return gEeprom.BATTERY_SAVE * 10;
+}
+
+static void Run(uint16_t (*pGetDuration)(void), uint32_t Phase, uint32_t End, Result_t *pResult, uint64_t *pAwake, uint64_t *pAsleep)
+{
+	uint64_t Awake;
+	uint64_t Asleep;
+	uint32_t Time;
+	uint32_t CallEnd;
+	uint32_t i;
+
+	gNextCall = 0;
+	for (i = 0; i < gCallCount; i++) {
+		gCalls[i].bHeard = false;
+	}
+	gBatterySaveIdleCycles = 0;
+
+	Awake = 0;
+	Asleep = 0;
+	Time = 0;
+	while (Time < End) {
+		if (Listen(Time, Time + AWAKE_TICKS + Phase, &CallEnd)) {
+			gBatterySaveIdleCycles = 0;
+			Awake += CallEnd - Time;
+			Time = CallEnd;
+			continue;
+		}
+		Awake += AWAKE_TICKS + Phase;
+		Time += AWAKE_TICKS + Phase;
+		while (Time < End) {
+			const uint16_t Duration = pGetDuration();
+
+			Asleep += Duration;
+			Time += Duration;
+			if (gNextCall < gCallCount && gCalls[gNextCall].Start < Time + RX_WINDOW_TICKS && Listen(Time, Time + RX_WINDOW_TICKS, &CallEnd)) {
+				gBatterySaveIdleCycles = 0;
+				Awake += CallEnd - Time;
+				Time = CallEnd;
+				break;
+			}
+			Awake += RX_WINDOW_TICKS;
+			Time += RX_WINDOW_TICKS;
+		}
+	}
+
+	*pAwake += Awake;
+	*pAsleep += Asleep;
+	for (i = 0; i < gCallCount && gCalls[i].End <= End; i++) {
+		const uint32_t Length = (gCalls[i].End - gCalls[i].Start) * 10U;
+		uint8_t Range;
+
+		if (Length < 200U) {
+			Range = LENGTH_SHORT;
+		} else if (Length < BATTERY_SAVE_PREAMBLE) {
+			Range = LENGTH_MEDIUM;
+		} else {
+			Range = LENGTH_LONG;
+		}
+		pResult->Calls[Range]++;
+		pResult->Missed[Range] += !gCalls[i].bHeard;
+	}
+}
+
+static void Simulate(uint16_t (*pGetDuration)(void), uint32_t End, Result_t *pResult)
+{
+	uint64_t Awake;
+	uint64_t Asleep;
+	uint32_t i;
+
+	for (i = 0; i < LENGTH_COUNT; i++) {
+		pResult->Calls[i] = 0;
+		pResult->Missed[i] = 0;
+	}
+	Awake = 0;
+	Asleep = 0;
+	for (i = 0; i < PHASES; i++) {
+		Run(pGetDuration, i * PHASE_STEP_TICKS, End, pResult, &Awake, &Asleep);
+	}
+	pResult->Current = (double)((Awake * AWAKE_MA) + (Asleep * SLEEP_MA)) / (double)(Awake + Asleep);
+}
+
+static double Percent(const Result_t *pResult, uint8_t Range)
+{
+	return pResult->Calls[Range] ? (100.0 * pResult->Missed[Range]) / pResult->Calls[Range] : 0.0;
+}
+
+int main(void)
+{
+	static const char *Names[] = { "quiet", "busy", "bursty" };
+	const uint32_t End = HOURS * 3600U * TICKS_PER_SECOND;
+	uint32_t Failed;
+	uint8_t Trace;
+	uint8_t Save;
+	uint8_t i;
+
+	printf("%u h per trace, %u mA awake, %u mA asleep, missed calls <200 ms / <%u ms / longer\n",
+		HOURS, AWAKE_MA, SLEEP_MA, BATTERY_SAVE_PREAMBLE);
+
+	Failed = 0;
+	for (Trace = TRACE_QUIET; Trace <= TRACE_BURSTY; Trace++) {
+		MakeTrace(Trace, End);
+		for (Save = 1; Save <= 4; Save++) {
+			Result_t Fixed;
+			Result_t Adaptive;
+
+			gEeprom.BATTERY_SAVE = Save;
+			Simulate(FixedSaveDuration, End, &Fixed);
+			Simulate(BATTERY_GetSaveDuration, End, &Adaptive);
+
+			printf("%-6s 1:%u  fixed %5.1f mA %5.1f%% %5.1f%% %5.1f%%  adaptive %5.1f mA %5.1f%% %5.1f%% %5.1f%%\n",
+				Names[Trace], Save,
+				Fixed.Current, Percent(&Fixed, LENGTH_SHORT), Percent(&Fixed, LENGTH_MEDIUM), Percent(&Fixed, LENGTH_LONG),
+				Adaptive.Current, Percent(&Adaptive, LENGTH_SHORT), Percent(&Adaptive, LENGTH_MEDIUM), Percent(&Adaptive, LENGTH_LONG));
+
+			if (Fixed.Missed[LENGTH_LONG] || Adaptive.Missed[LENGTH_LONG]) {
+				printf("FAIL: a call of %u ms or more was missed\n", BATTERY_SAVE_PREAMBLE);
+				Failed++;
+			}
+			for (i = 0; i < LENGTH_COUNT; i++) {
+				if (Adaptive.Missed[i] * 1000U > (Fixed.Missed[i] * 1000U) + (MISS_SLACK * Adaptive.Calls[i])) {
+					printf("FAIL: adaptive timing misses more calls than fixed\n");
+					Failed++;
+					break;
+				}
+			}
+		}
+	}
+
+	return Failed ? 1 : 0;
+}
+
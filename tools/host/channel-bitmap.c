@@ -0,0 +1,185 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+// Checks the channel bitmap search against the old linear scan.
+//
+// Channel tables from empty to full are built in gMR_ChannelAttributes
+// and loaded with RADIO_UpdateChannelBitmap, as BOARD_EEPROM_Init does.
+// RADIO_FindNextChannel is compared with the old loop over
+// RADIO_CheckValidChannel for every start channel, direction, scan list
+// and priority channel pair, then both are timed on a sparse and a dense
+// table.
+
+#include <stdio.h>
+#include <time.h>
+#include "misc.c"
+#include "radio.c"
+
+#define BENCH_ROUNDS 2000U
+
+EEPROM_Config_t gEeprom;
+
+static volatile uint32_t gSink;
+
+static uint8_t LinearFindNextChannel(uint8_t Channel, int8_t Direction, bool bCheckScanList, uint8_t VFO)
+{
+	uint8_t i;
+
+	for (i = 0; i < 200; i++) {
+		if (Channel == 0xFF) {
+			Channel = MR_CHANNEL_LAST;
+		} else if (Channel > MR_CHANNEL_LAST) {
+			Channel = MR_CHANNEL_FIRST;
+		}
+		if (RADIO_CheckValidChannel(Channel, bCheckScanList, VFO)) {
+			return Channel;
+		}
+		Channel += Direction;
+	}
+
+	return 0xFF;
+}
+
+static uint32_t gSeed = 1;
+
+static uint32_t Random(void)
+{
+	gSeed = (gSeed * 1103515245U) + 12345U;
+	return gSeed >> 16;
+}
+
+// Fills the table with Used channels out of 200, each in a random band
+// and scan list. Unused channels hold the erased 0xFF.
+static void FillTable(uint8_t Used)
+{
+	uint8_t i;
+
+	for (i = 0; i <= MR_CHANNEL_LAST; i++) {
+		gMR_ChannelAttributes[i] = 0xFF;
+	}
+	for (i = 0; i < Used; ) {
+		const uint8_t Channel = Random() % (MR_CHANNEL_LAST + 1U);
+
+		if (gMR_ChannelAttributes[Channel] != 0xFF) {
+			continue;
+		}
+		gMR_ChannelAttributes[Channel] = (Random() % (BAND7_470MHz + 1U)) | (Random() & (MR_CH_SCANLIST1 | MR_CH_SCANLIST2));
+		i++;
+	}
+	for (i = 0; i <= MR_CHANNEL_LAST; i++) {
+		RADIO_UpdateChannelBitmap(i);
+	}
+}
+
+static uint32_t Compare(void)
+{
+	static const uint8_t Starts[] = { 0xFF, MR_CHANNEL_LAST + 1U };
+	uint32_t Failed;
+	uint16_t Start;
+	uint8_t VFO;
+	uint8_t Dir;
+	uint8_t Check;
+
+	Failed = 0;
+	for (Start = 0; Start < (MR_CHANNEL_LAST + 1U) + sizeof(Starts); Start++) {
+		const uint8_t Channel = Start <= MR_CHANNEL_LAST ? Start : Starts[Start - (MR_CHANNEL_LAST + 1U)];
+
+		for (Dir = 0; Dir < 2; Dir++) {
+			const int8_t Direction = Dir ? -1 : 1;
+
+			for (Check = 0; Check < 2; Check++) {
+				for (VFO = 0; VFO < 3; VFO++) {
+					const uint8_t Expected = LinearFindNextChannel(Channel, Direction, Check, VFO);
+					const uint8_t Result = RADIO_FindNextChannel(Channel, Direction, Check, VFO);
+
+					if (Result == Expected) {
+						continue;
+					}
+					if (Failed++ < 10) {
+						printf("FAIL: start %u direction %d scan list %u vfo %u: expected %u, got %u\n", Channel, Direction, Check, VFO, Expected, Result);
+					}
+				}
+			}
+		}
+	}
+
+	return Failed;
+}
+
+static double Bench(uint8_t (*pFind)(uint8_t, int8_t, bool, uint8_t))
+{
+	clock_t Start;
+	uint32_t Sum;
+	uint32_t Round;
+	uint8_t Channel;
+
+	Sum = 0;
+	Start = clock();
+	for (Round = 0; Round < BENCH_ROUNDS; Round++) {
+		for (Channel = 0; Channel <= MR_CHANNEL_LAST; Channel++) {
+			Sum += pFind(Channel, 1, true, 0);
+			Sum += pFind(Channel, -1, false, 0);
+		}
+	}
+	gSink = Sum;
+
+	return ((double)(clock() - Start) * 1e9) / ((double)CLOCKS_PER_SEC * BENCH_ROUNDS * (MR_CHANNEL_LAST + 1U) * 2U);
+}
+
+int main(void)
+{
+	static const uint8_t Counts[] = { 0, 1, 2, 3, 5, 10, 32, 64, 100, 150, 199, 200 };
+	static const struct {
+		const char *pName;
+		uint8_t Used;
+	} Tables[] = {
+		{ "sparse", 5 },
+		{ "dense", 200 },
+	};
+	uint32_t Checked;
+	uint32_t Failed;
+	uint8_t Pass;
+	uint8_t i;
+
+	Checked = 0;
+	Failed = 0;
+	for (i = 0; i < sizeof(Counts) / sizeof(Counts[0]); i++) {
+		for (Pass = 0; Pass < 20; Pass++) {
+			FillTable(Counts[i]);
+			// Priority channels picked from anywhere, including unused
+			// ones and the 0xFF of an unset priority
+			gEeprom.SCANLIST_PRIORITY_CH1[0] = Pass & 1 ? 0xFF : Random() % (MR_CHANNEL_LAST + 1U);
+			gEeprom.SCANLIST_PRIORITY_CH2[0] = Pass & 2 ? 0xFF : Random() % (MR_CHANNEL_LAST + 1U);
+			gEeprom.SCANLIST_PRIORITY_CH1[1] = Random() % (MR_CHANNEL_LAST + 1U);
+			gEeprom.SCANLIST_PRIORITY_CH2[1] = gEeprom.SCANLIST_PRIORITY_CH1[1] + 1U;
+			Checked++;
+			Failed += Compare() != 0;
+		}
+	}
+	printf("%u channel tables checked, %u failed\n", Checked, Failed);
+
+	for (i = 0; i < sizeof(Tables) / sizeof(Tables[0]); i++) {
+		FillTable(Tables[i].Used);
+		gEeprom.SCANLIST_PRIORITY_CH1[0] = 0xFF;
+		gEeprom.SCANLIST_PRIORITY_CH2[0] = 0xFF;
+		printf("%-6s %3u channels  linear %7.1f ns  bitmap %7.1f ns per lookup\n",
+			Tables[i].pName, Tables[i].Used,
+			Bench(LinearFindNextChannel), Bench(RADIO_FindNextChannel));
+	}
+
+	return Failed ? 1 : 0;
+}
+
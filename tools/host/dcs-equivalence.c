@@ -0,0 +1,177 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+// Checks the table driven DCS code words against the old Golay encoder.
+//
+// The old DCS_CalculateGolay and the linear DCS_GetCdcssIndex are kept
+// here as the reference. Every option is encoded in both polarities, and
+// every 23 bit code word is looked up with both versions, plus random
+// words with the upper bits set. Both versions are then timed.
+
+#include <stdio.h>
+#include <time.h>
+#include "dcs.c"
+
+#define GOLAY_ROUNDS 20000U
+#define RANDOM_CODES 1000000U
+#define BENCH_STRIDE 16U
+
+static volatile uint32_t gSink;
+
+static uint32_t OldCalculateGolay(uint32_t CodeWord)
+{
+	uint32_t Word;
+	uint8_t i;
+
+	Word = CodeWord;
+	for (i = 0; i < 12; i++) {
+		Word <<= 1;
+		if (Word & 0x1000) {
+			Word ^= 0x08EA;
+		}
+	}
+	return CodeWord | ((Word & 0x0FFE) << 11);
+}
+
+static uint32_t OldGetGolayCodeWord(DCS_CodeType_t CodeType, uint8_t Option)
+{
+	uint32_t Code;
+
+	Code = OldCalculateGolay(DCS_Options[Option] + 0x800U);
+	if (CodeType == CODE_TYPE_REVERSE_DIGITAL) {
+		Code ^= 0x7FFFFF;
+	}
+
+	return Code;
+}
+
+static uint8_t OldGetCdcssIndex(uint32_t Code)
+{
+	uint8_t i;
+
+	for (i = 0; i < 23; i++) {
+		uint32_t Shift;
+
+		if (((Code >> 9) & 0x7U) == 4) {
+			uint8_t j;
+
+			for (j = 0; j < ARRAY_SIZE(DCS_Options); j++) {
+				if (DCS_Options[j] == (Code & 0x1FF)) {
+					if (OldGetGolayCodeWord(2, j) == Code) {
+						return j;
+					}
+				}
+			}
+		}
+		Shift = Code >> 1;
+		if (Code & 1U) {
+			Shift |= 0x400000U;
+		}
+		Code = Shift;
+	}
+
+	return 0xFF;
+}
+
+static double Seconds(clock_t Start)
+{
+	return (double)(clock() - Start) / CLOCKS_PER_SEC;
+}
+
+static double BenchGolay(uint32_t (*pGet)(DCS_CodeType_t, uint8_t))
+{
+	clock_t Start;
+	uint32_t Sum;
+	uint32_t Round;
+	uint8_t i;
+
+	Sum = 0;
+	Start = clock();
+	for (Round = 0; Round < GOLAY_ROUNDS; Round++) {
+		for (i = 0; i < ARRAY_SIZE(DCS_Options); i++) {
+			Sum += pGet(CODE_TYPE_DIGITAL, i);
+			Sum += pGet(CODE_TYPE_REVERSE_DIGITAL, i);
+		}
+	}
+	gSink = Sum;
+
+	return (Seconds(Start) * 1e9) / (GOLAY_ROUNDS * ARRAY_SIZE(DCS_Options) * 2U);
+}
+
+static double BenchCdcss(uint8_t (*pGet)(uint32_t))
+{
+	clock_t Start;
+	uint32_t Sum;
+	uint32_t Code;
+
+	Sum = 0;
+	Start = clock();
+	for (Code = 0; Code < 0x800000U; Code += BENCH_STRIDE) {
+		Sum += pGet(Code);
+	}
+	gSink = Sum;
+
+	return (Seconds(Start) * 1e9) / (0x800000U / BENCH_STRIDE);
+}
+
+int main(void)
+{
+	uint32_t Failed;
+	uint32_t Found;
+	uint32_t Code;
+	uint32_t Seed;
+	uint32_t i;
+	uint8_t Type;
+
+	Failed = 0;
+	for (i = 0; i < ARRAY_SIZE(DCS_Options); i++) {
+		for (Type = CODE_TYPE_DIGITAL; Type <= CODE_TYPE_REVERSE_DIGITAL; Type++) {
+			const uint32_t Expected = OldGetGolayCodeWord(Type, i);
+			const uint32_t Result = DCS_GetGolayCodeWord(Type, i);
+
+			if (Result != Expected && Failed++ < 10) {
+				printf("FAIL: option %u type %u: expected %06X, got %06X\n", i, Type, Expected, Result);
+			}
+		}
+	}
+
+	Found = 0;
+	for (Code = 0; Code < 0x800000U; Code++) {
+		const uint8_t Expected = OldGetCdcssIndex(Code);
+		const uint8_t Result = DCS_GetCdcssIndex(Code);
+
+		Found += Expected != 0xFF;
+		if (Result != Expected && Failed++ < 10) {
+			printf("FAIL: code %06X: expected %u, got %u\n", Code, Expected, Result);
+		}
+	}
+
+	Seed = 1;
+	for (i = 0; i < RANDOM_CODES; i++) {
+		Seed = (Seed * 1664525U) + 1013904223U;
+		if (OldGetCdcssIndex(Seed) != DCS_GetCdcssIndex(Seed) && Failed++ < 10) {
+			printf("FAIL: code %08X\n", Seed);
+		}
+	}
+
+	printf("%u options, %u code words (%u match an option), %u random words checked, %u failed\n",
+		(uint32_t)ARRAY_SIZE(DCS_Options) * 2U, 0x800000U, Found, RANDOM_CODES, Failed);
+	printf("DCS_GetGolayCodeWord  old %7.1f ns  new %7.1f ns per call\n", BenchGolay(OldGetGolayCodeWord), BenchGolay(DCS_GetGolayCodeWord));
+	printf("DCS_GetCdcssIndex     old %7.1f ns  new %7.1f ns per call\n", BenchCdcss(OldGetCdcssIndex), BenchCdcss(DCS_GetCdcssIndex));
+
+	return Failed ? 1 : 0;
+}
+
@@ -0,0 +1,292 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+// Checks the DTMF TX scheduler against the EEPROM timing settings.
+//
+// Sequences are queued with DTMF_Transmit and stepped with
+// DTMF_TimeSlice10ms. The BK4819 and radio calls are recorded with the
+// tick they happened on, and compared with a schedule built directly
+// from gEeprom: preload, then per digit the persist time (first, '*'/'#'
+// or normal) and the interval, then the 200 ms CxCSS tail. The EEPROM
+// loader only produces multiples of 10 ms from 0 to 1000 ms. A countdown
+// of 0 still takes one tick.
+
+#include <stdio.h>
+#include <string.h>
+#include "app/dtmf.c"
+#include "misc.c"
+
+#define MAX_EVENTS 256U
+#define MAX_TICKS 20000U
+#define TAIL_TICKS 20U
+
+enum {
+	EVENT_ENTER,
+	EVENT_TONE,
+	EVENT_MUTE,
+	EVENT_EXIT,
+	EVENT_CXCSS,
+	EVENT_AUDIO,
+	EVENT_RX,
+};
+
+typedef struct {
+	uint32_t Tick;
+	uint8_t Type;
+	char Code;
+} Event_t;
+
+EEPROM_Config_t gEeprom;
+bool gFmRadioMode;
+VFO_Info_t *gRxInfo;
+VFO_Info_t *gCrossTxRadioInfo;
+
+static VFO_Info_t gVfo;
+static Event_t gEvents[MAX_EVENTS];
+static uint32_t gEventCount;
+static uint32_t gTick;
+
+static void Record(uint8_t Type, char Code)
+{
+	if (gEventCount < MAX_EVENTS) {
+		gEvents[gEventCount].Tick = gTick;
+		gEvents[gEventCount].Type = Type;
+		gEvents[gEventCount].Code = Code;
+	}
+	gEventCount++;
+}
+
+void AUDIO_PlayBeep(BEEP_Type_t Beep)
+{
+	(void)Beep;
+}
+
+void BK4819_EnableScramble(uint8_t Type)
+{
+	(void)Type;
+}
+
+void BK4819_EnterDTMF_TX(bool bLocalLoopback)
+{
+	(void)bLocalLoopback;
+	Record(EVENT_ENTER, 0);
+}
+
+void BK4819_EnterTxMute(void)
+{
+	Record(EVENT_MUTE, 0);
+}
+
+void BK4819_ExitDTMF_TX(bool bKeep)
+{
+	(void)bKeep;
+	Record(EVENT_EXIT, 0);
+}
+
+void BK4819_ExitTxMute(void)
+{
+}
+
+void BK4819_PlayDTMF(char Code)
+{
+	Record(EVENT_TONE, Code);
+}
+
+void EEPROM_ReadBuffer(uint16_t Address, void *pBuffer, uint8_t Size)
+{
+	(void)Address;
+	memset(pBuffer, 0xFF, Size);
+}
+
+void FM_TurnOff(void)
+{
+}
+
+void FUNCTION_Select(FUNCTION_Type_t Function)
+{
+	(void)Function;
+}
+
+void GPIO_ClearBit(volatile uint32_t *pReg, uint8_t Bit)
+{
+	(void)pReg;
+	(void)Bit;
+}
+
+void GPIO_SetBit(volatile uint32_t *pReg, uint8_t Bit)
+{
+	(void)pReg;
+	(void)Bit;
+}
+
+void GUI_SelectNextDisplay(GUI_DisplayType_t Display)
+{
+	(void)Display;
+}
+
+void RADIO_EnableCxCSS(void)
+{
+	Record(EVENT_CXCSS, 0);
+}
+
+void RADIO_MarkTxPhase(RADIO_TxPhase_t Phase)
+{
+	(void)Phase;
+	Record(EVENT_AUDIO, 0);
+}
+
+void RADIO_SetupRegisters(bool bSwitchToFunction0)
+{
+	(void)bSwitchToFunction0;
+	Record(EVENT_RX, 0);
+}
+
+void SETTINGS_SaveSettings(void)
+{
+}
+
+void SYSTEM_DelayMs(uint32_t Delay)
+{
+	(void)Delay;
+}
+
+static uint32_t Ticks(uint16_t Time)
+{
+	return (Time / 10U) ? (Time / 10U) : 1U;
+}
+
+static uint32_t Expect(Event_t *pExpected, const char *pString, bool bDelayFirst, DTMF_TxEnd_t End)
+{
+	uint32_t Count;
+	uint32_t Tick;
+	uint8_t i;
+
+	Count = 0;
+	Tick = Ticks(gEeprom.DTMF_PRELOAD_TIME);
+	if (pString[0]) {
+		pExpected[Count++] = (Event_t){ Tick, EVENT_ENTER, 0 };
+	}
+	for (i = 0; pString[i]; i++) {
+		uint16_t Persist;
+
+		if (bDelayFirst && i == 0) {
+			Persist = gEeprom.DTMF_FIRST_CODE_PERSIST_TIME;
+		} else if (pString[i] == '*' || pString[i] == '#') {
+			Persist = gEeprom.DTMF_HASH_CODE_PERSIST_TIME;
+		} else {
+			Persist = gEeprom.DTMF_CODE_PERSIST_TIME;
+		}
+		pExpected[Count++] = (Event_t){ Tick, EVENT_TONE, pString[i] };
+		Tick += Ticks(Persist);
+		pExpected[Count++] = (Event_t){ Tick, EVENT_MUTE, 0 };
+		Tick += Ticks(gEeprom.DTMF_CODE_INTERVAL_TIME);
+	}
+	pExpected[Count++] = (Event_t){ Tick, EVENT_EXIT, 0 };
+	if (End == DTMF_TX_END_RESUME) {
+		pExpected[Count++] = (Event_t){ Tick, EVENT_AUDIO, 0 };
+		return Count;
+	}
+	pExpected[Count++] = (Event_t){ Tick, EVENT_CXCSS, 0 };
+	pExpected[Count++] = (Event_t){ Tick + TAIL_TICKS, EVENT_RX, 0 };
+
+	return Count;
+}
+
+static bool Check(const char *pString, bool bDelayFirst, DTMF_TxEnd_t End)
+{
+	static const char *Names[] = { "enter", "tone", "mute", "exit", "cxcss", "audio", "rx" };
+	Event_t Expected[MAX_EVENTS];
+	uint32_t Count;
+	uint32_t i;
+
+	gEventCount = 0;
+	gTick = 0;
+	DTMF_Transmit(pString, bDelayFirst, gEeprom.DTMF_PRELOAD_TIME, End);
+	while (gDTMF_TxState != DTMF_TX_IDLE && gTick < MAX_TICKS) {
+		gTick++;
+		DTMF_TimeSlice10ms();
+	}
+
+	Count = Expect(Expected, pString, bDelayFirst, End);
+	for (i = 0; i < Count || i < gEventCount; i++) {
+		if (i < Count && i < gEventCount && Expected[i].Tick == gEvents[i].Tick && Expected[i].Type == gEvents[i].Type && Expected[i].Code == gEvents[i].Code) {
+			continue;
+		}
+		printf("FAIL: \"%s\" preload %u first %u hash %u persist %u interval %u, event %u:",
+			pString,
+			gEeprom.DTMF_PRELOAD_TIME,
+			gEeprom.DTMF_FIRST_CODE_PERSIST_TIME,
+			gEeprom.DTMF_HASH_CODE_PERSIST_TIME,
+			gEeprom.DTMF_CODE_PERSIST_TIME,
+			gEeprom.DTMF_CODE_INTERVAL_TIME,
+			i);
+		if (i < Count) {
+			printf(" expected %s '%c' at %u ms,", Names[Expected[i].Type], Expected[i].Code ? Expected[i].Code : '-', Expected[i].Tick * 10U);
+		}
+		if (i < gEventCount) {
+			printf(" got %s '%c' at %u ms", Names[gEvents[i].Type], gEvents[i].Code ? gEvents[i].Code : '-', gEvents[i].Tick * 10U);
+		}
+		printf("\n");
+		return false;
+	}
+
+	return true;
+}
+
+int main(void)
+{
+	static const uint16_t Times[] = { 0, 10, 30, 50, 100, 250, 1000 };
+	static const char *Strings[] = { "", "1", "123", "*A#", "0123456789ABCD*#" };
+	static const DTMF_TxEnd_t Ends[] = { DTMF_TX_END_RESUME, DTMF_TX_END_TAIL, DTMF_TX_END_RX, DTMF_TX_END_RELEASE };
+	const uint32_t TimeCount = sizeof(Times) / sizeof(Times[0]);
+	uint32_t Config;
+	uint32_t Checked;
+	uint32_t Failed;
+	uint8_t i;
+	uint8_t j;
+
+	gRxInfo = &gVfo;
+	gCrossTxRadioInfo = &gVfo;
+
+	Checked = 0;
+	Failed = 0;
+	// Every combination of the five timing settings
+	for (Config = 0; Config < TimeCount * TimeCount * TimeCount * TimeCount * TimeCount; Config++) {
+		uint32_t Index = Config;
+
+		gEeprom.DTMF_PRELOAD_TIME = Times[Index % TimeCount];
+		Index /= TimeCount;
+		gEeprom.DTMF_FIRST_CODE_PERSIST_TIME = Times[Index % TimeCount];
+		Index /= TimeCount;
+		gEeprom.DTMF_HASH_CODE_PERSIST_TIME = Times[Index % TimeCount];
+		Index /= TimeCount;
+		gEeprom.DTMF_CODE_PERSIST_TIME = Times[Index % TimeCount];
+		Index /= TimeCount;
+		gEeprom.DTMF_CODE_INTERVAL_TIME = Times[Index % TimeCount];
+		for (i = 0; i < sizeof(Strings) / sizeof(Strings[0]); i++) {
+			for (j = 0; j < sizeof(Ends) / sizeof(Ends[0]); j++) {
+				Checked += 2;
+				Failed += !Check(Strings[i], true, Ends[j]);
+				Failed += !Check(Strings[i], false, Ends[j]);
+			}
+		}
+	}
+
+	printf("%u sequences checked, %u failed\n", Checked, Failed);
+
+	return Failed ? 1 : 0;
+}
+
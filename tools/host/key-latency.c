@@ -0,0 +1,240 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+// Key to key latency during rapid menu navigation.
+//
+// Keys are pressed on a fixed schedule and scanned once per 10 ms slice
+// with the debounce of APP_CheckKeys. Every accepted key starts
+// a 1 kHz beep, as a menu step does. Time advances only through
+// SYSTEM_DelayMs and while waiting for the next tick, so the latency seen
+// is what blocking calls add on top of the tick grid. Missed ticks are
+// coalesced into one, like gNextTimeslice.
+//
+// The beep sequencer in audio.c is measured against a model of the old
+// AUDIO_PlayBeep, which blocked for 172 ms per 1 kHz beep.
+
+#include <stdio.h>
+#include "audio.c"
+#include "misc.c"
+
+#define TICK_US 10000U
+#define KEY_COUNT 50U
+#define KEY_OFFSET_US 3000U
+#define BLOCKING_BEEP_MS 172U
+// The first scan after the press sees a new reading and two more are
+// needed to accept it, plus the 2 ms tone setup of a beep already playing.
+#define MAX_LATENCY_US (3U * TICK_US + 2000U)
+
+EEPROM_Config_t gEeprom;
+FUNCTION_Type_t gCurrentFunction;
+GUI_DisplayType_t gScreenToDisplay;
+bool gFmRadioMode;
+bool gThisCanEnable_BK4819_Rxon;
+VFO_Info_t *gRxInfo;
+
+static uint32_t gNow;
+
+void BK1080_Mute(bool bMute)
+{
+	(void)bMute;
+}
+
+void BK4819_EnterTxMute(void)
+{
+}
+
+void BK4819_ExitTxMute(void)
+{
+}
+
+uint16_t BK4819_GetRegister(BK4819_REGISTER_t Register)
+{
+	(void)Register;
+	return 0;
+}
+
+void BK4819_PlayTone(uint16_t Frequency, bool bTuningGainSwitch)
+{
+	(void)Frequency;
+	(void)bTuningGainSwitch;
+}
+
+void BK4819_RX_TurnOn(void)
+{
+}
+
+void BK4819_SetAF(BK4819_AF_Type_t AF)
+{
+	(void)AF;
+}
+
+void BK4819_Sleep(void)
+{
+}
+
+void BK4819_TurnsOffTones_TurnsOnRX(void)
+{
+}
+
+void BK4819_WriteRegister(BK4819_REGISTER_t Register, uint16_t Data)
+{
+	(void)Register;
+	(void)Data;
+}
+
+void GPIO_ClearBit(volatile uint32_t *pReg, uint8_t Bit)
+{
+	(void)pReg;
+	(void)Bit;
+}
+
+void GPIO_SetBit(volatile uint32_t *pReg, uint8_t Bit)
+{
+	(void)pReg;
+	(void)Bit;
+}
+
+void SYSTEM_DelayMs(uint32_t Delay)
+{
+	gNow += Delay * 1000U;
+}
+
+uint32_t SYSTICK_GetMicroseconds(void)
+{
+	return gNow;
+}
+
+static void PlaySequencer(void)
+{
+	AUDIO_PlayBeep(BEEP_1KHZ_60MS_OPTIONAL);
+}
+
+static void PlayBlocking(void)
+{
+	SYSTEM_DelayMs(BLOCKING_BEEP_MS);
+}
+
+static bool Measure(const char *pName, uint32_t IntervalMs, void (*pPlay)(void), bool bCheck)
+{
+	const uint32_t Interval = IntervalMs * 1000U;
+	const uint32_t Hold = Interval / 2U;
+	const uint32_t End = KEY_OFFSET_US + (KEY_COUNT * Interval);
+	uint32_t Accepted[KEY_COUNT];
+	uint32_t Next;
+	uint32_t Reading;
+	uint32_t Previous;
+	uint8_t Counter;
+	uint32_t Count;
+	uint32_t Total;
+	uint32_t Worst;
+	uint32_t Gap;
+	uint32_t Last;
+	uint32_t i;
+
+	gNow = 0;
+	Next = 0;
+	Previous = KEY_COUNT;
+	Counter = 0;
+	for (i = 0; i < KEY_COUNT; i++) {
+		Accepted[i] = 0;
+	}
+
+	while (gNow < End + Interval) {
+		if (gNow < Next) {
+			gNow = Next;
+		}
+		while (Next <= gNow) {
+			Next += TICK_US;
+		}
+
+		AUDIO_TimeSlice10ms();
+
+		Reading = KEY_COUNT;
+		if (gNow >= KEY_OFFSET_US) {
+			i = (gNow - KEY_OFFSET_US) / Interval;
+			if (i < KEY_COUNT && (gNow - KEY_OFFSET_US) % Interval < Hold) {
+				Reading = i;
+			}
+		}
+		if (Reading != Previous) {
+			Previous = Reading;
+			Counter = 0;
+			continue;
+		}
+		Counter++;
+		if (Counter == 2 && Reading != KEY_COUNT) {
+			Accepted[Reading] = gNow;
+			pPlay();
+		}
+	}
+
+	Count = 0;
+	Total = 0;
+	Worst = 0;
+	Gap = 0;
+	Last = 0;
+	for (i = 0; i < KEY_COUNT; i++) {
+		uint32_t Latency;
+
+		if (!Accepted[i]) {
+			continue;
+		}
+		Latency = Accepted[i] - (KEY_OFFSET_US + (i * Interval));
+		Count++;
+		Total += Latency;
+		if (Worst < Latency) {
+			Worst = Latency;
+		}
+		if (Last && Gap < Accepted[i] - Last) {
+			Gap = Accepted[i] - Last;
+		}
+		Last = Accepted[i];
+	}
+
+	printf("%-10s %4u ms  %2u/%2u keys  latency avg %6.1f ms  max %6.1f ms  key to key max %6.1f ms\n",
+		pName, IntervalMs, Count, KEY_COUNT,
+		Count ? (Total / (double)Count) / 1000.0 : 0.0,
+		Worst / 1000.0, Gap / 1000.0);
+
+	if (!bCheck) {
+		return true;
+	}
+	return Count == KEY_COUNT && Worst <= MAX_LATENCY_US;
+}
+
+int main(void)
+{
+	static const uint32_t Intervals[] = { 60, 80, 120, 200 };
+	bool bPassed;
+	uint8_t i;
+
+	gEeprom.BEEP_CONTROL = true;
+	gCurrentFunction = FUNCTION_0;
+	gScreenToDisplay = DISPLAY_MENU;
+
+	bPassed = true;
+	for (i = 0; i < sizeof(Intervals) / sizeof(Intervals[0]); i++) {
+		bPassed &= Measure("sequencer", Intervals[i], PlaySequencer, true);
+		Measure("blocking", Intervals[i], PlayBlocking, false);
+	}
+
+	if (!bPassed) {
+		printf("FAIL: a key was lost or took longer than %u us\n", MAX_LATENCY_US);
+		return 1;
+	}
+	return 0;
+}
+
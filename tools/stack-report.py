@@ -0,0 +1,117 @@
+#!/usr/bin/env python3
+# Copyright 2023 Dual Tachyon
+# https://github.com/DualTachyon
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Worst case stack depth from the .ci files written by -fcallgraph-info=su.
+
+import argparse
+import os
+import re
+import sys
+
+NODE = re.compile(r'node: \{ title: "([^"]*)" label: "([^"]*)"')
+EDGE = re.compile(r'edge: \{ sourcename: "([^"]*)" targetname: "([^"]*)"')
+USAGE = re.compile(r'(\d+) bytes \(([a-z,]+)\)')
+
+# Registers stacked by the Cortex-M0 on exception entry
+EXCEPTION_FRAME = 32
+
+def load(files):
+	frames = {}
+	calls = {}
+	for name in files:
+		if not os.path.exists(name):
+			continue
+		with open(name) as f:
+			for line in f:
+				m = NODE.search(line)
+				if m:
+					usage = USAGE.search(m.group(2).replace('\\n', ' '))
+					if usage:
+						frames[m.group(1)] = (int(usage.group(1)), usage.group(2))
+					continue
+				m = EDGE.search(line)
+				if m:
+					calls.setdefault(m.group(1), set()).add(m.group(2))
+	return frames, calls
+
+def walk(frames, calls):
+	worst = {}
+	notes = {}
+	active = set()
+
+	def depth(func):
+		if func in worst:
+			return worst[func]
+		if func in active:
+			notes.setdefault(func, set()).add('recursive')
+			return 0, []
+		active.add(func)
+		size, kind = frames.get(func, (0, 'static'))
+		note = set()
+		if kind != 'static':
+			note.add(kind)
+		best = 0
+		path = []
+		for callee in sorted(calls.get(func, ())):
+			if callee == '__indirect_call':
+				note.add('indirect')
+				continue
+			d, p = depth(callee)
+			if callee not in frames and callee not in calls:
+				note.add('external')
+			if d > best:
+				best = d
+				path = p
+			note |= notes.get(callee, set())
+		active.discard(func)
+		worst[func] = (size + best, [func] + path)
+		notes[func] = note
+		return worst[func]
+
+	for func in sorted(frames):
+		depth(func)
+	return worst, notes
+
+def main():
+	parser = argparse.ArgumentParser()
+	parser.add_argument('--available', type=lambda x: int(x, 0), default=0)
+	parser.add_argument('--top', type=int, default=15)
+	parser.add_argument('files', nargs='+')
+	args = parser.parse_args()
+
+	frames, calls = load(args.files)
+	worst, notes = walk(frames, calls)
+
+	print('%6s  %6s  %s' % ('frame', 'worst', 'function'))
+	for func in sorted(worst, key=lambda f: -worst[f][0])[:args.top]:
+		extra = ' [%s]' % ', '.join(sorted(notes[func])) if notes[func] else ''
+		print('%6d  %6d  %s%s' % (frames.get(func, (0,))[0], worst[func][0], func, extra))
+
+	main_depth, main_path = worst.get('Main', (0, []))
+	isr_depth, isr_path = worst.get('SystickHandler', (0, []))
+	total = main_depth + isr_depth + EXCEPTION_FRAME
+	print()
+	print('Main:           %5d  %s' % (main_depth, ' > '.join(main_path)))
+	print('SystickHandler: %5d  %s' % (isr_depth, ' > '.join(isr_path)))
+	print('Worst case:     %5d  (including the %d byte exception frame)' % (total, EXCEPTION_FRAME))
+	if args.available:
+		print('Available:      %5d' % args.available)
+		if total > args.available:
+			return 1
+	return 0
+
+if __name__ == '__main__':
+	sys.exit(main())
@@ -61,7 +61,7 @@ void UI_DisplayFM(void)
 			if (!gFM_AutoScan) {
 				strcpy(String, "M-SCAN");
 			} else {
-				sprintf(String, "A-SCAN(%d)", gFM_ChannelPosition + 1);
+				sprintf(String, "A-SCAN(%d)", gFM_ChannelPosition < 20 ? gFM_ChannelPosition + 1 : 20);
 			}
 		}
 	}
@@ -58,9 +58,14 @@ void UI_DisplayLock(void)
 
 	while (1) {
 		while (!gNextTimeslice) {
+			AUDIO_ShiftVoiceID();
 		}
 		// TODO: Original code doesn't do the below, but is needed for proper key debounce.
 		gNextTimeslice = false;
+		AUDIO_TimeSlice10ms();
+		if (AUDIO_IsVoiceSending()) {
+			continue;
+		}
 		Key = KEYBOARD_Poll();
 		if (gKeyReading0 == Key) {
 			gDebounceCounter++;
@@ -21,6 +21,7 @@
 #include "driver/st7565.h"
 #include "external/printf/printf.h"
 #include "helper/battery.h"
+#include "helper/energy.h"
 #include "misc.h"
 #include "settings.h"
 #include "ui/helper.h"
@@ -51,7 +52,7 @@ static const char MenuList[][7] = {
 	"NOAA_S", "DEL-CH",  "RESET",  "350TX",
 	"F-LOCK", "200TX",   "500TX",  "350EN",
 	// 0x38
-	"SCREN",
+	"SCREN",  "POWER",
 };
 
 static const uint16_t gSubMenu_Step[] = {
@@ -402,6 +403,10 @@ void UI_DisplayMenu(void)
 		sprintf(String, "%.2fV", gBatteryVoltageAverage * 0.01);
 		break;
 
+	case MENU_POWER:
+		sprintf(String, "%umAh", ENERGY_GetConsumption() / 1000U);
+		break;
+
 	case MENU_RESET:
 		strcpy(String, gSubMenu_RESET[gSubMenuSelection]);
 		break;
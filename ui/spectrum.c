@@ -0,0 +1,125 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#include <string.h>
+#include "app/spectrum.h"
+#include "driver/st7565.h"
+#include "external/printf/printf.h"
+#include "misc.h"
+#include "ui/helper.h"
+#include "ui/spectrum.h"
+
+static void UI_DrawSpectrumPixel(uint8_t X, uint8_t Height)
+{
+	// Bars grow upwards from the bottom of line 6
+	const uint8_t Y = 55 - Height;
+
+	gFrameBuffer[Y >> 3][X] |= 1U << (Y & 7U);
+}
+
+static void UI_DrawSpectrumBars(void)
+{
+	uint8_t i;
+	uint8_t j;
+
+	for (i = 0; i < SPECTRUM_BINS; i++) {
+		const uint8_t X = i * 2;
+
+		for (j = 0; j < gSpectrumLevel[i]; j++) {
+			UI_DrawSpectrumPixel(X, j);
+		}
+		if (gSpectrumPeak[i]) {
+			UI_DrawSpectrumPixel(X, gSpectrumPeak[i] - 1);
+			UI_DrawSpectrumPixel(X + 1, gSpectrumPeak[i] - 1);
+		}
+	}
+}
+
+static void UI_DrawSpectrumWaterfall(void)
+{
+	uint8_t Age;
+	uint8_t i;
+
+	// Newest sweep on top, each older one a pixel row further down
+	for (Age = 0; Age < SPECTRUM_HISTORY; Age++) {
+		const uint8_t Height = SPECTRUM_HEIGHT - 1 - Age;
+
+		for (i = 0; i < SPECTRUM_BINS; i++) {
+			const uint8_t X = i * 2;
+
+			switch (SPECTRUM_GetHistory(Age, i)) {
+			case 3:
+				UI_DrawSpectrumPixel(X + 1, Height);
+				// Fallthrough
+			case 2:
+				UI_DrawSpectrumPixel(X, Height);
+				break;
+			case 1:
+				if ((Age ^ i) & 1U) {
+					UI_DrawSpectrumPixel(X, Height);
+				}
+				break;
+			default:
+				break;
+			}
+		}
+	}
+}
+
+static void UI_DrawSpectrumBody(void)
+{
+	char String[8];
+
+	memset(gFrameBuffer[2], 0, sizeof(gFrameBuffer[0]) * 5);
+
+	NUMBER_ToDigits(gSpectrumBinsPerSecond, String);
+	UI_DisplaySmallDigits(4, String + 4, 0, 2);
+	gFrameBuffer[2][SPECTRUM_BINS - 1] = 0xE0;
+	gFrameBuffer[2][SPECTRUM_BINS] = 0xE0;
+
+	if (gSpectrumWaterfall) {
+		UI_DrawSpectrumWaterfall();
+	} else {
+		UI_DrawSpectrumBars();
+	}
+}
+
+void UI_DisplaySpectrum(void)
+{
+	// Worst case is "42949.673 100.00K" for any 32-bit frequency
+	char String[20];
+
+	memset(gFrameBuffer, 0, sizeof(gFrameBuffer));
+
+	sprintf(String, "%.3f %.2fK", gSpectrumCenter * 1e-05, SPECTRUM_GetStep() * 0.01);
+	UI_PrintString(String, 0, 127, 0, 8, true);
+	UI_DrawSpectrumBody();
+
+	ST7565_BlitFullScreen();
+}
+
+void UI_UpdateSpectrum(void)
+{
+	uint8_t Line;
+
+	// Only the lines below the frequency change between sweeps, and
+	// blitting them alone avoids the delay of a full screen update.
+	UI_DrawSpectrumBody();
+	for (Line = 2; Line < 7; Line++) {
+		ST7565_BlitLine(Line);
+	}
+}
+
@@ -24,6 +24,7 @@
 #include "ui/main.h"
 #include "ui/menu.h"
 #include "ui/scanner.h"
+#include "ui/spectrum.h"
 #include "ui/ui.h"
 
 GUI_DisplayType_t gScreenToDisplay;
@@ -51,6 +52,9 @@ void GUI_DisplayScreen(void)
 	case DISPLAY_AIRCOPY:
 		UI_DisplayAircopy();
 		break;
+	case DISPLAY_SPECTRUM:
+		UI_DisplaySpectrum();
+		break;
 	default:
 		break;
 	}
@@ -26,6 +26,7 @@ enum GUI_DisplayType_t {
 	DISPLAY_MENU	= 0x02U,
 	DISPLAY_SCANNER	= 0x03U,
 	DISPLAY_AIRCOPY	= 0x04U,
+	DISPLAY_SPECTRUM	= 0x05U,
 	DISPLAY_INVALID	= 0xFFU,
 };
 